@@ -0,0 +1,52 @@
+//  CBHArrayView.h
+//  CBHMapReduceKit
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+@import Foundation;
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+/** A live, filtered or mapped, view over a mutable array or mutable ordered set.
+ *
+ * The view keeps its own copy of the mapped elements so reads are O(1), alongside which indexes of the source they came from,
+ * kept so that each is placed in O(log n). Mutations made through `mutableSource` are applied to the source and then to the view,
+ * mapping only the elements that changed, so the view cannot fall out of step with them.
+ *
+ * @warning     A view is not thread safe. A source mutated other than through `mutableSource` must be followed by `reload`, which
+ *              debug builds assert when the view is next read.
+ */
+@interface CBHArrayView<__covariant ElementType> : NSArray<ElementType>
+
+#pragma mark - Source
+
+/** A proxy for the source of the view that updates the view after each mutation.
+ *
+ * An `NSMutableArray` for a view over a mutable array, or an `NSMutableOrderedSet` for a view over a mutable ordered set.
+ */
+@property (nonatomic, readonly) id mutableSource;
+
+
+#pragma mark - Updating
+
+/** Rebuilds the view from its entire source.
+ */
+- (void)reload;
+
+@end
+
+NS_ASSUME_NONNULL_END
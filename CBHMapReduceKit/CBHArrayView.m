@@ -0,0 +1,190 @@
+//  CBHArrayView.m
+//  CBHMapReduceKit
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+#import "CBHArrayView.h"
+
+#import "_CBHArrayView.h"
+#import "_CBHViewIndexes.h"
+#import "_CBHViewSources.h"
+
+
+/// Asserts, in debug builds, that the source has not been mutated behind the back of the view.
+#define CBHArrayViewAssertInStep() NSAssert([_source count] == [_indexes count], @"The source of a view was mutated other than through its mutableSource without the view being reloaded.")
+
+
+@implementation CBHArrayView
+{
+	NSArray *_source;
+	id _mutableSource;
+	id (^_transform)(id object);
+
+	NSMutableArray *_objects;
+	CBHViewIndexes *_indexes;
+}
+
+
+#pragma mark - Initialization
+
+- (instancetype)initWithSource:(id)source transform:(id (^)(id object))transform
+{
+	if ( (self = [super init]) )
+	{
+		if ( [source isKindOfClass:[NSOrderedSet class]] )
+		{
+			_source = [source array];
+			_mutableSource = [[CBHOrderedSetViewSource alloc] initWithSource:source view:self];
+		}
+		else
+		{
+			_source = source;
+			_mutableSource = [[CBHArrayViewSource alloc] initWithSource:source view:self];
+		}
+
+		_transform = [transform copy];
+
+		_objects = [[NSMutableArray alloc] initWithCapacity:[source count]];
+		_indexes = [[CBHViewIndexes alloc] init];
+
+		[self reload];
+	}
+
+	return self;
+}
+
+
+#pragma mark - Source
+
+- (id)mutableSource
+{
+	return _mutableSource;
+}
+
+
+#pragma mark - NSArray
+
+- (NSUInteger)count
+{
+	CBHArrayViewAssertInStep();
+	return [_objects count];
+}
+
+- (id)objectAtIndex:(NSUInteger)index
+{
+	CBHArrayViewAssertInStep();
+	return [_objects objectAtIndex:index];
+}
+
+- (NSUInteger)countByEnumeratingWithState:(NSFastEnumerationState *)state objects:(id __unsafe_unretained [])buffer count:(NSUInteger)length
+{
+	return [_objects countByEnumeratingWithState:state objects:buffer count:length];
+}
+
+- (id)copyWithZone:(NSZone *)zone
+{
+	return [_objects copyWithZone:zone];
+}
+
+- (id)mutableCopyWithZone:(NSZone *)zone
+{
+	return [_objects mutableCopyWithZone:zone];
+}
+
+- (Class)classForCoder
+{
+	return [NSArray class];
+}
+
+
+#pragma mark - Updating
+
+- (void)sourceDidInsertObjectsAtIndexes:(NSIndexSet *)indexes
+{
+	[indexes enumerateIndexesUsingBlock:^(NSUInteger index, BOOL *stop) {
+		id mapping = self->_transform([self->_source objectAtIndex:index]);
+		[self->_indexes insertIndex:index included:( mapping != nil )];
+
+		if ( mapping ) { [self->_objects insertObject:mapping atIndex:[self->_indexes positionOfIndex:index]]; }
+	}];
+
+	CBHArrayViewAssertInStep();
+}
+
+- (void)sourceDidRemoveObjectsAtIndexes:(NSIndexSet *)indexes
+{
+	[indexes enumerateIndexesWithOptions:NSEnumerationReverse usingBlock:^(NSUInteger index, BOOL *stop) {
+		if ( [self->_indexes containsIndex:index] )
+		{
+			[self->_objects removeObjectAtIndex:[self->_indexes positionOfIndex:index]];
+		}
+
+		[self->_indexes removeIndex:index];
+	}];
+
+	CBHArrayViewAssertInStep();
+}
+
+- (void)sourceDidReplaceObjectsAtIndexes:(NSIndexSet *)indexes
+{
+	[indexes enumerateIndexesUsingBlock:^(NSUInteger index, BOOL *stop) {
+		id mapping = self->_transform([self->_source objectAtIndex:index]);
+		NSUInteger position = [self->_indexes positionOfIndex:index];
+		BOOL isIncluded = [self->_indexes containsIndex:index];
+
+		if ( isIncluded && mapping )
+		{
+			[self->_objects replaceObjectAtIndex:position withObject:mapping];
+		}
+		else if ( isIncluded )
+		{
+			[self->_objects removeObjectAtIndex:position];
+			[self->_indexes setIncluded:NO atIndex:index];
+		}
+		else if ( mapping )
+		{
+			[self->_objects insertObject:mapping atIndex:position];
+			[self->_indexes setIncluded:YES atIndex:index];
+		}
+	}];
+
+	CBHArrayViewAssertInStep();
+}
+
+- (void)reload
+{
+	NSMutableIndexSet *included = [[NSMutableIndexSet alloc] init];
+	NSUInteger index = 0;
+
+	[_objects removeAllObjects];
+
+	for (id object in _source)
+	{
+		id mapping = _transform(object);
+
+		if ( mapping )
+		{
+			[_objects addObject:mapping];
+			[included addIndex:index];
+		}
+
+		++index;
+	}
+
+	[_indexes resetWithCount:index includedIndexes:included];
+}
+
+@end
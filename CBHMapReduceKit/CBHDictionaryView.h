@@ -0,0 +1,48 @@
+//  CBHDictionaryView.h
+//  CBHMapReduceKit
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+@import Foundation;
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+/** A live, filtered or mapped, view over the values of a mutable dictionary.
+ *
+ * The view keeps its own copy of the mapped values so reads are O(1). Mutations made through `mutableSource` are applied to the
+ * source and then to the view, mapping only the value that changed, so the view cannot fall out of step with them.
+ *
+ * @warning     A view is not thread safe. A source mutated other than through `mutableSource` must be followed by `reload`.
+ */
+@interface CBHDictionaryView<__covariant KeyType, __covariant ElementType> : NSDictionary<KeyType, ElementType>
+
+#pragma mark - Source
+
+/** A proxy for the source of the view that updates the view after each mutation.
+ */
+@property (nonatomic, readonly) NSMutableDictionary<KeyType, id> *mutableSource;
+
+
+#pragma mark - Updating
+
+/** Rebuilds the view from its entire source.
+ */
+- (void)reload;
+
+@end
+
+NS_ASSUME_NONNULL_END
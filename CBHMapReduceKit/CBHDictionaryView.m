@@ -0,0 +1,121 @@
+//  CBHDictionaryView.m
+//  CBHMapReduceKit
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+#import "CBHDictionaryView.h"
+
+#import "_CBHDictionaryView.h"
+#import "_CBHViewSources.h"
+
+
+@implementation CBHDictionaryView
+{
+	NSDictionary *_source;
+	CBHDictionaryViewSource *_mutableSource;
+	id (^_transform)(id key, id value);
+
+	NSMutableDictionary *_objects;
+}
+
+
+#pragma mark - Initialization
+
+- (instancetype)initWithSource:(NSMutableDictionary *)source transform:(id (^)(id key, id value))transform
+{
+	if ( (self = [super init]) )
+	{
+		_source = source;
+		_mutableSource = [[CBHDictionaryViewSource alloc] initWithSource:source view:self];
+		_transform = [transform copy];
+
+		_objects = [[NSMutableDictionary alloc] initWithCapacity:[source count]];
+
+		[self reload];
+	}
+
+	return self;
+}
+
+
+#pragma mark - Source
+
+- (NSMutableDictionary *)mutableSource
+{
+	return _mutableSource;
+}
+
+
+#pragma mark - NSDictionary
+
+- (NSUInteger)count
+{
+	return [_objects count];
+}
+
+- (id)objectForKey:(id)key
+{
+	return [_objects objectForKey:key];
+}
+
+- (NSEnumerator *)keyEnumerator
+{
+	return [_objects keyEnumerator];
+}
+
+- (NSUInteger)countByEnumeratingWithState:(NSFastEnumerationState *)state objects:(id __unsafe_unretained [])buffer count:(NSUInteger)length
+{
+	return [_objects countByEnumeratingWithState:state objects:buffer count:length];
+}
+
+- (id)copyWithZone:(NSZone *)zone
+{
+	return [_objects copyWithZone:zone];
+}
+
+- (id)mutableCopyWithZone:(NSZone *)zone
+{
+	return [_objects mutableCopyWithZone:zone];
+}
+
+- (Class)classForCoder
+{
+	return [NSDictionary class];
+}
+
+
+#pragma mark - Updating
+
+- (void)sourceDidChangeObjectForKey:(id)key
+{
+	id value = [_source objectForKey:key];
+	id mapping = ( value ) ? _transform(key, value) : nil;
+
+	if ( mapping ) { [_objects setObject:mapping forKey:key]; }
+	else { [_objects removeObjectForKey:key]; }
+}
+
+- (void)reload
+{
+	[_objects removeAllObjects];
+
+	[_source enumerateKeysAndObjectsUsingBlock:^(id key, id value, BOOL *stop) {
+		id mapping = self->_transform(key, value);
+		if ( mapping ) { [self->_objects setObject:mapping forKey:key]; }
+	}];
+}
+
+@end
@@ -0,0 +1,31 @@
+//  CBHJoinOptions.h
+//  CBHMapReduceKit
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+@import Foundation.NSObjCRuntime;
+
+
+/** Options that control how a join is performed.
+ *
+ * @constant CBHJoinOptionsNone         The join is performed serially on the calling thread.
+ * @constant CBHJoinOptionsConcurrent   The probing side of the join is partitioned and probed concurrently by the default executor. The key and combine closures must be safe to call from multiple threads.
+ */
+typedef NS_OPTIONS(NSUInteger, CBHJoinOptions)
+{
+	CBHJoinOptionsNone          = 0,
+	CBHJoinOptionsConcurrent    = 1 << 0,
+};
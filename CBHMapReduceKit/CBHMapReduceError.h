@@ -0,0 +1,34 @@
+//  CBHMapReduceError.h
+//  CBHMapReduceKit
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+@import Foundation;
+
+
+/// The domain of errors reported by CBHMapReduceKit.
+FOUNDATION_EXPORT NSErrorDomain const CBHMapReduceErrorDomain;
+
+/** The codes of errors in the `CBHMapReduceErrorDomain`.
+ *
+ * @constant CBHMapReduceErrorSpillFailed           A temporary file used to spill intermediate state could not be created, written or read. The underlying POSIX error is included.
+ * @constant CBHMapReduceErrorUnencodableObject     A key, element or accumulated value could not be spilled because it is not a property-list object and does not conform to `NSCoding`.
+ */
+typedef NS_ERROR_ENUM(CBHMapReduceErrorDomain, CBHMapReduceErrorCode)
+{
+	CBHMapReduceErrorSpillFailed          = 1,
+	CBHMapReduceErrorUnencodableObject    = 2,
+};
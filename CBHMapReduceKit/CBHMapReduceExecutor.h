@@ -0,0 +1,114 @@
+//  CBHMapReduceExecutor.h
+//  CBHMapReduceKit
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+@import Foundation;
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+/** An executor schedules the work of the concurrent map, filter and reduce methods across threads.
+ *
+ * Custom executors subclass it, initialize with `initWithWorkerCount:` and override `applyRangesOfCount:block:`.
+ */
+@interface CBHMapReduceExecutor : NSObject
+
+#pragma mark - Factories
+
+/** Returns an executor that performs all the work on the calling thread.
+ *
+ * @return  A serial executor.
+ */
++ (instancetype)serialExecutor;
+
+/** Returns an executor that splits the work into a fixed number of equally sized chunks and runs them with `dispatch_apply`.
+ *
+ * @return  A libdispatch backed executor using one worker for each active processor.
+ */
++ (instancetype)dispatchExecutor;
+
+/** Returns an executor that splits the work into a fixed number of equally sized chunks and runs them with `dispatch_apply`.
+ *
+ * @param workerCount   The number of workers to divide the work between.
+ *
+ * @return              A libdispatch backed executor.
+ */
++ (instancetype)dispatchExecutorWithWorkerCount:(NSUInteger)workerCount;
+
+/** Returns an executor where each worker splits its work adaptively and idle workers steal work from busy ones.
+ *
+ * This executor should be preferred when the cost of each element varies greatly.
+ *
+ * @return  A work-stealing executor using one worker for each active processor.
+ */
++ (instancetype)workStealingExecutor;
+
+/** Returns an executor where each worker splits its work adaptively and idle workers steal work from busy ones.
+ *
+ * This executor should be preferred when the cost of each element varies greatly.
+ *
+ * @param workerCount   The number of workers to divide the work between.
+ *
+ * @return              A work-stealing executor.
+ */
++ (instancetype)workStealingExecutorWithWorkerCount:(NSUInteger)workerCount;
+
+- (instancetype)init NS_UNAVAILABLE;
++ (instancetype)new NS_UNAVAILABLE;
+
+
+#pragma mark - Initialization
+
+/** Initializes an executor.
+ *
+ * @param workerCount   The number of workers to divide the work between. At least one worker is always used.
+ *
+ * @return              The initialized executor.
+ */
+- (instancetype)initWithWorkerCount:(NSUInteger)workerCount NS_DESIGNATED_INITIALIZER;
+
+
+#pragma mark - Default
+
+/** The executor used by concurrent operations that are not given one explicitly. Initially a work-stealing executor.
+ */
+@property (class, nonatomic, strong) CBHMapReduceExecutor *defaultExecutor;
+
+
+#pragma mark - Properties
+
+/** The number of workers the executor divides work between.
+ */
+@property (nonatomic, readonly) NSUInteger workerCount;
+
+
+#pragma mark - Execution
+
+/** Calls the given closure with subranges that together cover each index below `count` exactly once, and returns after all calls have completed.
+ *
+ * This is the method subclasses override to schedule work. The implementation of this class calls `block` once with the whole
+ * range on the calling thread. Overrides should divide the work between `workerCount` workers, must not return before every call
+ * has completed, and should call `block` inside an autorelease pool when it runs on another thread.
+ *
+ * @param count     The number of indexes to cover.
+ * @param block     A closure that performs the work of a subrange. It may be called concurrently from multiple threads.
+ */
+- (void)applyRangesOfCount:(NSUInteger)count block:(void (^)(NSRange range))block;
+
+@end
+
+NS_ASSUME_NONNULL_END
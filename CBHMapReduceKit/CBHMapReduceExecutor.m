@@ -0,0 +1,308 @@
+//  CBHMapReduceExecutor.m
+//  CBHMapReduceKit
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+#import "CBHMapReduceExecutor.h"
+
+#import <pthread.h>
+#import <sched.h>
+#import <stdatomic.h>
+
+
+/// Splitting halves a range each time, so a deque never holds more ranges than there are bits in an index.
+#define CBHWorkStealingDequeCapacity (sizeof(NSUInteger) * 8 * 2)
+
+/// Each worker aims to split its share into this many chunks so there is always something left to steal.
+static const NSUInteger CBHWorkStealingChunksPerWorker = 64;
+
+
+typedef struct
+{
+	pthread_mutex_t lock;
+	NSUInteger top;
+	NSUInteger bottom;
+	NSRange ranges[CBHWorkStealingDequeCapacity];
+} CBHWorkStealingDeque;
+
+
+@interface CBHSerialExecutor : CBHMapReduceExecutor
+@end
+
+@interface CBHDispatchExecutor : CBHMapReduceExecutor
+@end
+
+@interface CBHWorkStealingExecutor : CBHMapReduceExecutor
+@end
+
+
+static NSUInteger CBHActiveProcessorCount(void)
+{
+	return MAX((NSUInteger)1, [[NSProcessInfo processInfo] activeProcessorCount]);
+}
+
+
+@implementation CBHMapReduceExecutor
+
+#pragma mark - Factories
+
++ (instancetype)serialExecutor
+{
+	return [[CBHSerialExecutor alloc] initWithWorkerCount:1];
+}
+
++ (instancetype)dispatchExecutor
+{
+	return [self dispatchExecutorWithWorkerCount:CBHActiveProcessorCount()];
+}
+
++ (instancetype)dispatchExecutorWithWorkerCount:(NSUInteger)workerCount
+{
+	return [[CBHDispatchExecutor alloc] initWithWorkerCount:workerCount];
+}
+
++ (instancetype)workStealingExecutor
+{
+	return [self workStealingExecutorWithWorkerCount:CBHActiveProcessorCount()];
+}
+
++ (instancetype)workStealingExecutorWithWorkerCount:(NSUInteger)workerCount
+{
+	return [[CBHWorkStealingExecutor alloc] initWithWorkerCount:workerCount];
+}
+
+
+#pragma mark - Initialization
+
+- (instancetype)initWithWorkerCount:(NSUInteger)workerCount
+{
+	if ( (self = [super init]) )
+	{
+		_workerCount = MAX((NSUInteger)1, workerCount);
+	}
+
+	return self;
+}
+
+
+#pragma mark - Default
+
+static CBHMapReduceExecutor *_defaultExecutor = nil;
+
++ (CBHMapReduceExecutor *)defaultExecutor
+{
+	@synchronized (self)
+	{
+		if ( !_defaultExecutor ) { _defaultExecutor = [self workStealingExecutor]; }
+		return _defaultExecutor;
+	}
+}
+
++ (void)setDefaultExecutor:(CBHMapReduceExecutor *)executor
+{
+	@synchronized (self)
+	{
+		_defaultExecutor = executor;
+	}
+}
+
+
+#pragma mark - Execution
+
+- (void)applyRangesOfCount:(NSUInteger)count block:(void (^)(NSRange range))block
+{
+	if ( count == 0 ) { return; }
+	block(NSMakeRange(0, count));
+}
+
+@end
+
+
+@implementation CBHSerialExecutor
+@end
+
+
+@implementation CBHDispatchExecutor
+
+- (void)applyRangesOfCount:(NSUInteger)count block:(void (^)(NSRange range))block
+{
+	NSUInteger chunkCount = MIN(count, [self workerCount] * 4);
+	if ( chunkCount < 2 ) { [super applyRangesOfCount:count block:block]; return; }
+
+	NSUInteger chunkSize = count / chunkCount;
+	NSUInteger remainder = count % chunkCount;
+
+	dispatch_apply(chunkCount, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^(size_t chunk) {
+		@autoreleasepool
+		{
+			NSUInteger location = chunk * chunkSize + MIN(chunk, remainder);
+			NSUInteger length = chunkSize + (( chunk < remainder ) ? 1 : 0);
+			block(NSMakeRange(location, length));
+		}
+	});
+}
+
+@end
+
+
+@implementation CBHWorkStealingExecutor
+
+#pragma mark - Deques
+
+static BOOL CBHDequePush(CBHWorkStealingDeque *deque, NSRange range)
+{
+	BOOL pushed = NO;
+	pthread_mutex_lock(&deque->lock);
+
+	if ( deque->bottom < CBHWorkStealingDequeCapacity )
+	{
+		deque->ranges[deque->bottom++] = range;
+		pushed = YES;
+	}
+
+	pthread_mutex_unlock(&deque->lock);
+	return pushed;
+}
+
+/// The owner takes the most recently pushed, and so smallest, range.
+static BOOL CBHDequePop(CBHWorkStealingDeque *deque, NSRange *range)
+{
+	BOOL popped = NO;
+	pthread_mutex_lock(&deque->lock);
+
+	if ( deque->top < deque->bottom )
+	{
+		*range = deque->ranges[--deque->bottom];
+		if ( deque->top == deque->bottom ) { deque->top = deque->bottom = 0; }
+		popped = YES;
+	}
+
+	pthread_mutex_unlock(&deque->lock);
+	return popped;
+}
+
+/// Thieves take the oldest, and so largest, range.
+static BOOL CBHDequeSteal(CBHWorkStealingDeque *deque, NSRange *range)
+{
+	BOOL stolen = NO;
+	pthread_mutex_lock(&deque->lock);
+
+	if ( deque->top < deque->bottom )
+	{
+		*range = deque->ranges[deque->top++];
+		if ( deque->top == deque->bottom ) { deque->top = deque->bottom = 0; }
+		stolen = YES;
+	}
+
+	pthread_mutex_unlock(&deque->lock);
+	return stolen;
+}
+
+
+#pragma mark - Workers
+
+static BOOL CBHWorkStealingTake(CBHWorkStealingDeque *deques, NSUInteger workerCount, NSUInteger worker, NSRange *range)
+{
+	if ( CBHDequePop(&deques[worker], range) ) { return YES; }
+
+	for (NSUInteger offset = 1; offset < workerCount; ++offset)
+	{
+		if ( CBHDequeSteal(&deques[(worker + offset) % workerCount], range) ) { return YES; }
+	}
+
+	return NO;
+}
+
+static void CBHWorkStealingRun(CBHWorkStealingDeque *deques, NSUInteger workerCount, NSUInteger worker, NSUInteger grain, _Atomic(NSUInteger) *outstanding, void (^block)(NSRange range))
+{
+	for (;;)
+	{
+		NSRange range;
+
+		if ( !CBHWorkStealingTake(deques, workerCount, worker, &range) )
+		{
+			/// New ranges only appear while a worker splits one it took, so once none are outstanding there is nothing left to steal.
+			if ( atomic_load_explicit(outstanding, memory_order_acquire) == 0 ) { return; }
+
+			sched_yield();
+			continue;
+		}
+
+		/// Keep the lower half and leave the upper half where an idle worker can steal it.
+		while ( range.length > grain )
+		{
+			NSUInteger half = range.length / 2;
+			atomic_fetch_add_explicit(outstanding, 1, memory_order_relaxed);
+
+			if ( !CBHDequePush(&deques[worker], NSMakeRange(range.location + half, range.length - half)) )
+			{
+				atomic_fetch_sub_explicit(outstanding, 1, memory_order_relaxed);
+				break;
+			}
+
+			range.length = half;
+		}
+
+		/// The taken range stops counting once its upper halves are in the deque.
+		atomic_fetch_sub_explicit(outstanding, 1, memory_order_release);
+
+		@autoreleasepool
+		{
+			block(range);
+		}
+	}
+}
+
+
+#pragma mark - Execution
+
+- (void)applyRangesOfCount:(NSUInteger)count block:(void (^)(NSRange range))block
+{
+	NSUInteger workerCount = MIN(count, [self workerCount]);
+	if ( workerCount < 2 ) { [super applyRangesOfCount:count block:block]; return; }
+
+	CBHWorkStealingDeque *deques = calloc(workerCount, sizeof(CBHWorkStealingDeque));
+	NSUInteger share = count / workerCount;
+	NSUInteger remainder = count % workerCount;
+
+	for (NSUInteger worker = 0; worker < workerCount; ++worker)
+	{
+		pthread_mutex_init(&deques[worker].lock, NULL);
+
+		NSUInteger location = worker * share + MIN(worker, remainder);
+		NSUInteger length = share + (( worker < remainder ) ? 1 : 0);
+		deques[worker].ranges[deques[worker].bottom++] = NSMakeRange(location, length);
+	}
+
+	NSUInteger grain = MAX((NSUInteger)1, count / (workerCount * CBHWorkStealingChunksPerWorker));
+
+	/// Counts the ranges in the deques and those taken but not yet split, so workers stop looking once it reaches zero.
+	_Atomic(NSUInteger) outstanding = workerCount;
+	_Atomic(NSUInteger) *outstandingPointer = &outstanding;
+
+	dispatch_apply(workerCount, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^(size_t worker) {
+		CBHWorkStealingRun(deques, workerCount, worker, grain, outstandingPointer, block);
+	});
+
+	for (NSUInteger worker = 0; worker < workerCount; ++worker)
+	{
+		pthread_mutex_destroy(&deques[worker].lock);
+	}
+
+	free(deques);
+}
+
+@end
@@ -0,0 +1,130 @@
+//  CBHMapReduceInstrumentation.h
+//  CBHMapReduceKit
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+@import Foundation;
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+/** A report of a single call to a mapping, filtering or reducing method.
+ *
+ * Durations are in nanoseconds. Calls made from within another call, such as an immutable method forwarding to its mutable
+ * counterpart, are reported as part of the outermost call.
+ */
+@interface CBHMapReduceCallRecord : NSObject
+
+#pragma mark - Call Site
+
+/// The name of the class the method belongs to, such as `NSArray` or `NSMutableDictionary`.
+@property (nonatomic, readonly) NSString *category;
+
+/// The selector of the method called.
+@property (nonatomic, readonly) SEL selector;
+
+
+#pragma mark - Counts
+
+/// The number of times the closure passed to the method was called.
+@property (nonatomic, readonly) NSUInteger inputCount;
+
+/// The number of elements in the result, the number of doubles in a packed result, `1` for a result that is not a collection, or `0` for `nil`.
+@property (nonatomic, readonly) NSUInteger outputCount;
+
+/** The number of result containers allocated by the call.
+ *
+ * Counts the result itself unless it is the receiver, and each collection directly inside it, such as the groups of a grouping or
+ * the windows of a windowing, that was not already an element of the receiver. Containers used only while the call ran are not
+ * counted.
+ */
+@property (nonatomic, readonly) NSUInteger containerCount;
+
+
+#pragma mark - Timing
+
+/// The time at which the call began, in nanoseconds of system uptime.
+@property (nonatomic, readonly) uint64_t startTime;
+
+/// The wall time taken by the call.
+@property (nonatomic, readonly) uint64_t duration;
+
+/// The time spent in the closure passed to the method, summed across threads for concurrent methods.
+@property (nonatomic, readonly) uint64_t blockDuration;
+
+/// The time spent outside the closure enumerating and building containers.
+@property (nonatomic, readonly) uint64_t containerDuration;
+
+
+#pragma mark - Exporting
+
+/** Returns the record as a property list suitable for emitting as a trace event or as counters.
+ *
+ * @return  A dictionary of the record's properties keyed by their names, with the selector as a string.
+ */
+- (NSDictionary<NSString *, id> *)dictionaryRepresentation;
+
+
+#pragma mark - Initialization
+
+- (instancetype)init NS_UNAVAILABLE;
++ (instancetype)new NS_UNAVAILABLE;
+
+@end
+
+
+/** An object that is told about each instrumented call once it completes.
+ */
+@protocol CBHMapReduceObserver <NSObject>
+
+/** Tells the observer that a call completed.
+ *
+ * Called synchronously on the thread that made the call, so implementations should be quick.
+ *
+ * @param record    The report of the call.
+ */
+- (void)mapReduceDidCompleteCall:(CBHMapReduceCallRecord *)record;
+
+@end
+
+
+/** Opt-in instrumentation of the mapping, filtering and reducing methods.
+ *
+ * While no observer is installed each instrumented method pays for a single, predictable branch.
+ */
+@interface CBHMapReduceInstrumentation : NSObject
+
+#pragma mark - Observing
+
+/// The observer told about calls made on any thread without a scoped observer, or `nil` to disable it.
+@property (class, nonatomic, strong, nullable) id<CBHMapReduceObserver> observer;
+
+/** Performs a closure, telling an observer about the calls it makes on the current thread in place of the global observer.
+ *
+ * @param observer  The observer to tell about calls.
+ * @param block     The closure to perform.
+ */
++ (void)performWithObserver:(id<CBHMapReduceObserver>)observer block:(void (NS_NOESCAPE ^)(void))block;
+
+
+#pragma mark - Initialization
+
+- (instancetype)init NS_UNAVAILABLE;
++ (instancetype)new NS_UNAVAILABLE;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,372 @@
+//  CBHMapReduceInstrumentation.m
+//  CBHMapReduceKit
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+#import "CBHMapReduceInstrumentation.h"
+
+#import "_CBHMapReduceInstrumentation.h"
+
+#import <mach/mach_time.h>
+
+
+_Atomic(NSUInteger) CBHInstrumentationObserverCount = 0;
+
+/// The observer installed by `performWithObserver:block:` on this thread, retained by that method's frame.
+static __thread void *CBHScopedObserver = NULL;
+
+/// The observer told about calls on threads without a scoped observer.
+static id<CBHMapReduceObserver> CBHGlobalObserver = nil;
+
+/// The record of the outermost call in progress on this thread, retained by that call's frame.
+static __thread void *CBHCurrentRecord = NULL;
+
+/// The frame address of the method that began the current record. Calls nested in it have frames below it on the stack.
+static __thread uintptr_t CBHCurrentFrame = 0;
+
+
+static uint64_t CBHNanosecondsFromTicks(uint64_t ticks)
+{
+	static mach_timebase_info_data_t timebase;
+	static dispatch_once_t onceToken;
+	dispatch_once(&onceToken, ^{ mach_timebase_info(&timebase); });
+
+	return ticks * timebase.numer / timebase.denom;
+}
+
+
+static BOOL CBHIsContainer(id object)
+{
+	return [object conformsToProtocol:@protocol(NSFastEnumeration)] || [object isKindOfClass:[NSData class]];
+}
+
+/// Counts the result and the containers directly inside it that were not elements of the receiver.
+static NSUInteger CBHAllocatedContainerCount(id receiver, id result)
+{
+	if ( !CBHIsContainer(result) || result == receiver ) { return 0; }
+
+	/// Enumerating a lazy enumerator would consume it, so only the enumerator itself is counted.
+	if ( [result isKindOfClass:[NSEnumerator class]] || [result isKindOfClass:[NSData class]] ) { return 1; }
+
+	id<NSFastEnumeration> members = ( [result isKindOfClass:[NSDictionary class]] ) ? [(NSDictionary *)result allValues] : result;
+	NSHashTable *existing = nil;
+	NSUInteger count = 1;
+
+	for (id member in members)
+	{
+		if ( !CBHIsContainer(member) ) { continue; }
+
+		if ( !existing )
+		{
+			existing = [[NSHashTable alloc] initWithOptions:NSPointerFunctionsStrongMemory | NSPointerFunctionsObjectPointerPersonality capacity:0];
+
+			/// An enumerator receiver has already been consumed by the call, so none of its elements can be found.
+			if ( ![receiver isKindOfClass:[NSEnumerator class]] )
+			{
+				id<NSFastEnumeration> elements = ( [receiver isKindOfClass:[NSDictionary class]] ) ? [(NSDictionary *)receiver allValues] : receiver;
+				for (id element in elements) { [existing addObject:element]; }
+			}
+		}
+
+		if ( ![existing containsObject:member] ) { ++count; }
+	}
+
+	return count;
+}
+
+
+@interface CBHMapReduceCallRecord ()
+
+- (instancetype)initWithCategory:(NSString *)category selector:(SEL)selector observer:(id<CBHMapReduceObserver>)observer;
+
+@property (nonatomic, readonly) id<CBHMapReduceObserver> observer;
+
+- (void)addBlockCallWithStartTicks:(uint64_t)startTicks isCounted:(BOOL)isCounted;
+- (void)completeWithReceiver:(id)receiver result:(id)result;
+
+@end
+
+
+@implementation CBHMapReduceCallRecord
+{
+	uint64_t _startTicks;
+	uint64_t _endTicks;
+
+	_Atomic(uint64_t) _blockTicks;
+	_Atomic(NSUInteger) _blockCalls;
+}
+
+
+#pragma mark - Initialization
+
+- (instancetype)initWithCategory:(NSString *)category selector:(SEL)selector observer:(id<CBHMapReduceObserver>)observer
+{
+	if ( (self = [super init]) )
+	{
+		_category = [category copy];
+		_selector = selector;
+		_observer = observer;
+
+		atomic_init(&_blockTicks, 0);
+		atomic_init(&_blockCalls, 0);
+
+		_startTicks = mach_absolute_time();
+	}
+
+	return self;
+}
+
+
+#pragma mark - Properties
+
+- (NSUInteger)inputCount
+{
+	return atomic_load_explicit(&_blockCalls, memory_order_relaxed);
+}
+
+- (uint64_t)startTime
+{
+	return CBHNanosecondsFromTicks(_startTicks);
+}
+
+- (uint64_t)duration
+{
+	return CBHNanosecondsFromTicks(_endTicks - _startTicks);
+}
+
+- (uint64_t)blockDuration
+{
+	return CBHNanosecondsFromTicks(atomic_load_explicit(&_blockTicks, memory_order_relaxed));
+}
+
+- (uint64_t)containerDuration
+{
+	uint64_t duration = [self duration];
+	uint64_t blockDuration = [self blockDuration];
+
+	/// Concurrent calls can spend longer in their closures than they take overall.
+	return ( duration > blockDuration ) ? duration - blockDuration : 0;
+}
+
+
+#pragma mark - Recording
+
+- (void)addBlockCallWithStartTicks:(uint64_t)startTicks isCounted:(BOOL)isCounted
+{
+	atomic_fetch_add_explicit(&_blockTicks, mach_absolute_time() - startTicks, memory_order_relaxed);
+	if ( isCounted ) { atomic_fetch_add_explicit(&_blockCalls, 1, memory_order_relaxed); }
+}
+
+- (void)completeWithReceiver:(id)receiver result:(id)result
+{
+	_endTicks = mach_absolute_time();
+
+	if ( !result ) { _outputCount = 0; }
+	else if ( [result respondsToSelector:@selector(count)] ) { _outputCount = [(NSArray *)result count]; }
+	else if ( [result isKindOfClass:[NSData class]] ) { _outputCount = [(NSData *)result length] / sizeof(double); }
+	else { _outputCount = 1; }
+
+	_containerCount = CBHAllocatedContainerCount(receiver, result);
+}
+
+
+#pragma mark - Exporting
+
+- (NSDictionary<NSString *, id> *)dictionaryRepresentation
+{
+	return @{
+		@"category": _category,
+		@"selector": NSStringFromSelector(_selector),
+		@"inputCount": @([self inputCount]),
+		@"outputCount": @(_outputCount),
+		@"containerCount": @(_containerCount),
+		@"startTime": @([self startTime]),
+		@"duration": @([self duration]),
+		@"blockDuration": @([self blockDuration]),
+		@"containerDuration": @([self containerDuration]),
+	};
+}
+
+@end
+
+
+/// Reinstates the scoped observer that was installed before `performWithObserver:block:`, as the cleanup of its variable.
+static void CBHRestoreScopedObserver(void **previous)
+{
+	atomic_fetch_sub_explicit(&CBHInstrumentationObserverCount, 1, memory_order_relaxed);
+	CBHScopedObserver = *previous;
+}
+
+
+@implementation CBHMapReduceInstrumentation
+
+#pragma mark - Observing
+
++ (id<CBHMapReduceObserver>)observer
+{
+	@synchronized (self)
+	{
+		return CBHGlobalObserver;
+	}
+}
+
++ (void)setObserver:(id<CBHMapReduceObserver>)observer
+{
+	@synchronized (self)
+	{
+		if ( !CBHGlobalObserver && observer ) { atomic_fetch_add_explicit(&CBHInstrumentationObserverCount, 1, memory_order_relaxed); }
+		if ( CBHGlobalObserver && !observer ) { atomic_fetch_sub_explicit(&CBHInstrumentationObserverCount, 1, memory_order_relaxed); }
+
+		CBHGlobalObserver = observer;
+	}
+}
+
++ (void)performWithObserver:(id<CBHMapReduceObserver>)observer block:(void (NS_NOESCAPE ^)(void))block
+{
+	void *previous __attribute__((cleanup(CBHRestoreScopedObserver))) = CBHScopedObserver;
+
+	CBHScopedObserver = (__bridge void *)observer;
+	atomic_fetch_add_explicit(&CBHInstrumentationObserverCount, 1, memory_order_relaxed);
+
+	block();
+}
+
+@end
+
+
+#pragma mark - Instrumenting
+
+CBHMapReduceCallRecord *CBHInstrumentationBegin(NSString *category, SEL selector, void *frame)
+{
+	/// A record whose frame is not above this one was abandoned by a call that threw, so it is replaced.
+	if ( CBHCurrentRecord && (uintptr_t)frame < CBHCurrentFrame ) { return nil; }
+
+	id<CBHMapReduceObserver> observer = (__bridge id<CBHMapReduceObserver>)CBHScopedObserver;
+	if ( !observer ) { observer = [CBHMapReduceInstrumentation observer]; }
+	if ( !observer ) { return nil; }
+
+	CBHMapReduceCallRecord *record = [[CBHMapReduceCallRecord alloc] initWithCategory:category selector:selector observer:observer];
+	CBHCurrentRecord = (__bridge void *)record;
+	CBHCurrentFrame = (uintptr_t)frame;
+
+	return record;
+}
+
+id CBHInstrumentationEnd(CBHMapReduceCallRecord *record, id receiver, id result)
+{
+	[record completeWithReceiver:receiver result:result];
+	CBHCurrentRecord = NULL;
+
+	[[record observer] mapReduceDidCompleteCall:record];
+
+	return result;
+}
+
+void CBHInstrumentationClearRecord(CBHMapReduceCallRecord * __strong *record)
+{
+	if ( *record && CBHCurrentRecord == (__bridge void *)*record ) { CBHCurrentRecord = NULL; }
+}
+
+__attribute__((overloadable)) CBHInstrumentedTransform CBHInstrumentationWrap(CBHMapReduceCallRecord *record, CBHInstrumentedTransform transform, BOOL isCounted)
+{
+	if ( !transform ) { return nil; }
+
+	return ^id (id object) {
+		uint64_t start = mach_absolute_time();
+		id mapping = transform(object);
+		[record addBlockCallWithStartTicks:start isCounted:isCounted];
+
+		return mapping;
+	};
+}
+
+__attribute__((overloadable)) CBHInstrumentedPredicate CBHInstrumentationWrap(CBHMapReduceCallRecord *record, CBHInstrumentedPredicate predicate, BOOL isCounted)
+{
+	if ( !predicate ) { return nil; }
+
+	return ^BOOL (id object) {
+		uint64_t start = mach_absolute_time();
+		BOOL isIncluded = predicate(object);
+		[record addBlockCallWithStartTicks:start isCounted:isCounted];
+
+		return isIncluded;
+	};
+}
+
+__attribute__((overloadable)) CBHInstrumentedPairTransform CBHInstrumentationWrap(CBHMapReduceCallRecord *record, CBHInstrumentedPairTransform transform, BOOL isCounted)
+{
+	if ( !transform ) { return nil; }
+
+	return ^id (id first, id second) {
+		uint64_t start = mach_absolute_time();
+		id mapping = transform(first, second);
+		[record addBlockCallWithStartTicks:start isCounted:isCounted];
+
+		return mapping;
+	};
+}
+
+__attribute__((overloadable)) CBHInstrumentedPairPredicate CBHInstrumentationWrap(CBHMapReduceCallRecord *record, CBHInstrumentedPairPredicate predicate, BOOL isCounted)
+{
+	if ( !predicate ) { return nil; }
+
+	return ^BOOL (id first, id second) {
+		uint64_t start = mach_absolute_time();
+		BOOL isIncluded = predicate(first, second);
+		[record addBlockCallWithStartTicks:start isCounted:isCounted];
+
+		return isIncluded;
+	};
+}
+
+__attribute__((overloadable)) CBHInstrumentedDoubleValue CBHInstrumentationWrap(CBHMapReduceCallRecord *record, CBHInstrumentedDoubleValue value, BOOL isCounted)
+{
+	if ( !value ) { return nil; }
+
+	return ^double (id object) {
+		uint64_t start = mach_absolute_time();
+		double result = value(object);
+		[record addBlockCallWithStartTicks:start isCounted:isCounted];
+
+		return result;
+	};
+}
+
+__attribute__((overloadable)) CBHInstrumentedDoubleAccumulator CBHInstrumentationWrap(CBHMapReduceCallRecord *record, CBHInstrumentedDoubleAccumulator accumulator, BOOL isCounted)
+{
+	if ( !accumulator ) { return nil; }
+
+	return ^double (double accumulated, id object) {
+		uint64_t start = mach_absolute_time();
+		double result = accumulator(accumulated, object);
+		[record addBlockCallWithStartTicks:start isCounted:isCounted];
+
+		return result;
+	};
+}
+
+__attribute__((overloadable)) CBHInstrumentedDoubleCombine CBHInstrumentationWrap(CBHMapReduceCallRecord *record, CBHInstrumentedDoubleCombine combine, BOOL isCounted)
+{
+	if ( !combine ) { return nil; }
+
+	return ^double (double lhs, double rhs) {
+		uint64_t start = mach_absolute_time();
+		double result = combine(lhs, rhs);
+		[record addBlockCallWithStartTicks:start isCounted:isCounted];
+
+		return result;
+	};
+}
@@ -23,6 +23,13 @@ FOUNDATION_EXPORT double CBHMapReduceKitVersionNumber;
 FOUNDATION_EXPORT const unsigned char CBHMapReduceKitVersionString[];
 
 
+#import <CBHMapReduceKit/CBHJoinOptions.h>
+#import <CBHMapReduceKit/CBHMapReduceError.h>
+#import <CBHMapReduceKit/CBHMapReduceExecutor.h>
+#import <CBHMapReduceKit/CBHMapReduceInstrumentation.h>
+#import <CBHMapReduceKit/CBHArrayView.h>
+#import <CBHMapReduceKit/CBHDictionaryView.h>
+
 #import <CBHMapReduceKit/NSArray+CBHMapReduceKit.h>
 
 #import <CBHMapReduceKit/NSSet+CBHMapReduceKit.h>
@@ -31,3 +38,7 @@ FOUNDATION_EXPORT const unsigned char CBHMapReduceKitVersionString[];
 #import <CBHMapReduceKit/NSDictionary+CBHMapReduceKit.h>
 
 #import <CBHMapReduceKit/NSEnumerator+CBHMapReduceKit.h>
+
+#if defined(__cplusplus) && __has_feature(objc_arc)
+#import <CBHMapReduceKit/CBHMapReduceKit.hpp>
+#endif
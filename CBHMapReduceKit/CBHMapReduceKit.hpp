@@ -0,0 +1,361 @@
+//  CBHMapReduceKit.hpp
+//  CBHMapReduceKit
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+#if !defined(__cplusplus) || !defined(__OBJC__)
+#error "CBHMapReduceKit.hpp must be compiled as Objective-C++."
+#endif
+
+#if !__has_feature(objc_arc)
+#error "CBHMapReduceKit.hpp requires ARC."
+#endif
+
+#import <Foundation/Foundation.h>
+#import <objc/runtime.h>
+
+#include <algorithm>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+
+/** Templated map, filter and reduce over `NSArray`, `NSSet`, `NSOrderedSet`, `NSDictionary` and `NSEnumerator`.
+ *
+ * Unlike the category methods these accept any callable, such as a lambda, so the compiler is free to inline it into the loop.
+ * Elements are fetched in bulk and results are collected into a buffer that is turned into the result collection in one step.
+ *
+ * Sequences call their callables with an element. Dictionaries call them with a key and a value.
+ *
+ * The result type is given as the first template argument, for example `cbh::map<NSSet *>(array, transform)`. It must be one of the
+ * unparameterized `NSArray *`, `NSSet *`, `NSOrderedSet *` or `NSDictionary *` types or their mutable counterparts. Dictionary
+ * results keep the key of a dictionary source, or use the element of a sequence source as the key.
+ */
+namespace cbh
+{
+	namespace detail
+	{
+		constexpr NSUInteger batch_size = 256;
+
+
+		#pragma mark - Traversal
+
+		struct array_tag {};
+		struct ordered_set_tag {};
+		struct set_tag {};
+		struct dictionary_tag {};
+		struct enumeration_tag {};
+
+		template <class Collection>
+		using tag_t = typename std::conditional<std::is_same<Collection, id>::value, enumeration_tag,
+			typename std::conditional<std::is_convertible<Collection, NSArray *>::value, array_tag,
+			typename std::conditional<std::is_convertible<Collection, NSOrderedSet *>::value, ordered_set_tag,
+			typename std::conditional<std::is_convertible<Collection, NSSet *>::value, set_tag,
+			typename std::conditional<std::is_convertible<Collection, NSDictionary *>::value, dictionary_tag,
+			enumeration_tag>::type>::type>::type>::type>::type;
+
+
+		inline NSUInteger count_hint(NSArray *collection, array_tag) { return [collection count]; }
+		inline NSUInteger count_hint(NSOrderedSet *collection, ordered_set_tag) { return [collection count]; }
+		inline NSUInteger count_hint(NSSet *collection, set_tag) { return [collection count]; }
+		inline NSUInteger count_hint(NSDictionary *collection, dictionary_tag) { return [collection count]; }
+		inline NSUInteger count_hint(id<NSFastEnumeration>, enumeration_tag) { return 0; }
+
+
+		template <class Visit>
+		inline void for_each(NSArray *collection, array_tag, Visit &&visit)
+		{
+			__unsafe_unretained id buffer[batch_size];
+			NSUInteger count = [collection count];
+
+			for (NSUInteger location = 0; location < count; location += batch_size)
+			{
+				NSUInteger length = std::min(batch_size, count - location);
+				[collection getObjects:buffer range:NSMakeRange(location, length)];
+
+				for (NSUInteger i = 0; i < length; ++i) { visit(buffer[i]); }
+			}
+		}
+
+		template <class Visit>
+		inline void for_each(NSOrderedSet *collection, ordered_set_tag, Visit &&visit)
+		{
+			__unsafe_unretained id buffer[batch_size];
+			NSUInteger count = [collection count];
+
+			for (NSUInteger location = 0; location < count; location += batch_size)
+			{
+				NSUInteger length = std::min(batch_size, count - location);
+				[collection getObjects:buffer range:NSMakeRange(location, length)];
+
+				for (NSUInteger i = 0; i < length; ++i) { visit(buffer[i]); }
+			}
+		}
+
+		template <class Visit>
+		inline void fast_for_each(id<NSFastEnumeration> collection, Visit &&visit)
+		{
+			NSFastEnumerationState state = {};
+			__unsafe_unretained id buffer[batch_size];
+			unsigned long mutations = 0;
+			bool started = false;
+
+			for (NSUInteger count; (count = [collection countByEnumeratingWithState:&state objects:buffer count:batch_size]) != 0; )
+			{
+				if ( !started )
+				{
+					mutations = *state.mutationsPtr;
+					started = true;
+				}
+
+				for (NSUInteger i = 0; i < count; ++i)
+				{
+					if ( *state.mutationsPtr != mutations ) { objc_enumerationMutation(collection); }
+					visit(state.itemsPtr[i]);
+				}
+			}
+		}
+
+		template <class Visit>
+		inline void for_each(NSSet *collection, set_tag, Visit &&visit)
+		{
+			fast_for_each(collection, std::forward<Visit>(visit));
+		}
+
+		template <class Visit>
+		inline void for_each(id<NSFastEnumeration> collection, enumeration_tag, Visit &&visit)
+		{
+			fast_for_each(collection, std::forward<Visit>(visit));
+		}
+
+		template <class Visit>
+		inline void for_each(NSDictionary *collection, dictionary_tag, Visit &&visit)
+		{
+			NSUInteger count = [collection count];
+			std::vector<__unsafe_unretained id> keys(count);
+			std::vector<__unsafe_unretained id> values(count);
+			[collection getObjects:values.data() andKeys:keys.data() count:count];
+
+			for (NSUInteger i = 0; i < count; ++i) { visit(keys[i], values[i]); }
+		}
+
+
+		#pragma mark - Building
+
+		template <class Result>
+		struct container_traits;
+
+		template <> struct container_traits<NSArray *>
+		{
+			static NSArray *make(__unsafe_unretained id const *objects, NSUInteger count) { return [[NSArray alloc] initWithObjects:objects count:count]; }
+		};
+
+		template <> struct container_traits<NSMutableArray *>
+		{
+			static NSMutableArray *make(__unsafe_unretained id const *objects, NSUInteger count) { return [[NSMutableArray alloc] initWithObjects:objects count:count]; }
+		};
+
+		template <> struct container_traits<NSSet *>
+		{
+			static NSSet *make(__unsafe_unretained id const *objects, NSUInteger count) { return [[NSSet alloc] initWithObjects:objects count:count]; }
+		};
+
+		template <> struct container_traits<NSMutableSet *>
+		{
+			static NSMutableSet *make(__unsafe_unretained id const *objects, NSUInteger count) { return [[NSMutableSet alloc] initWithObjects:objects count:count]; }
+		};
+
+		template <> struct container_traits<NSOrderedSet *>
+		{
+			static NSOrderedSet *make(__unsafe_unretained id const *objects, NSUInteger count) { return [[NSOrderedSet alloc] initWithObjects:objects count:count]; }
+		};
+
+		template <> struct container_traits<NSMutableOrderedSet *>
+		{
+			static NSMutableOrderedSet *make(__unsafe_unretained id const *objects, NSUInteger count) { return [[NSMutableOrderedSet alloc] initWithObjects:objects count:count]; }
+		};
+
+		/// Collects the results of a sequence. Keys are accepted so dictionaries can be mapped into sequences, but are ignored.
+		template <class Result>
+		class builder
+		{
+			public:
+
+				explicit builder(NSUInteger capacity) { _objects.reserve(capacity); }
+
+				void add(id object) { _objects.push_back(object); }
+				void add(id, id object) { _objects.push_back(object); }
+
+				Result finish() { return container_traits<Result>::make(_objects.data(), _objects.size()); }
+
+			private:
+
+				std::vector<id> _objects;
+		};
+
+		template <> struct container_traits<NSDictionary *>
+		{
+			static NSDictionary *make(__unsafe_unretained id const *objects, __unsafe_unretained id<NSCopying> const *keys, NSUInteger count) { return [[NSDictionary alloc] initWithObjects:objects forKeys:keys count:count]; }
+		};
+
+		template <> struct container_traits<NSMutableDictionary *>
+		{
+			static NSMutableDictionary *make(__unsafe_unretained id const *objects, __unsafe_unretained id<NSCopying> const *keys, NSUInteger count) { return [[NSMutableDictionary alloc] initWithObjects:objects forKeys:keys count:count]; }
+		};
+
+		/// Collects the results of a dictionary. Elements of a sequence source are added with themselves as the key.
+		template <class Result>
+		class keyed_builder
+		{
+			public:
+
+				explicit keyed_builder(NSUInteger capacity)
+				{
+					_keys.reserve(capacity);
+					_objects.reserve(capacity);
+				}
+
+				void add(id object) { add(object, object); }
+
+				void add(id key, id object)
+				{
+					_keys.push_back(key);
+					_objects.push_back(object);
+				}
+
+				Result finish() { return container_traits<Result>::make(_objects.data(), _keys.data(), _objects.size()); }
+
+			private:
+
+				std::vector<id<NSCopying>> _keys;
+				std::vector<id> _objects;
+		};
+
+		template <> class builder<NSDictionary *> : public keyed_builder<NSDictionary *>
+		{
+			public: using keyed_builder<NSDictionary *>::keyed_builder;
+		};
+
+		template <> class builder<NSMutableDictionary *> : public keyed_builder<NSMutableDictionary *>
+		{
+			public: using keyed_builder<NSMutableDictionary *>::keyed_builder;
+		};
+
+
+		#pragma mark - Defaults
+
+		template <class Tag> struct filter_default { using type = NSArray *; };
+		template <> struct filter_default<ordered_set_tag> { using type = NSOrderedSet *; };
+		template <> struct filter_default<set_tag> { using type = NSSet *; };
+		template <> struct filter_default<dictionary_tag> { using type = NSDictionary *; };
+
+		template <class Result, class Collection>
+		using filter_result_t = typename std::conditional<std::is_void<Result>::value, typename filter_default<tag_t<Collection>>::type, Result>::type;
+	}
+
+
+	#pragma mark - Mapping
+
+	/** Returns a new collection containing the results of calling the given transformation with each element of a collection.
+	 *
+	 * @param collection    The collection to map.
+	 * @param transform     A callable that accepts an element, or a key and value, and returns a non-`nil` object.
+	 *
+	 * @return              A new collection, an `NSArray` unless otherwise specified, of the results of calling `transform`.
+	 */
+	template <class Result = NSArray *, class Collection, class Transform>
+	inline Result map(Collection collection, Transform &&transform)
+	{
+		using tag = detail::tag_t<Collection>;
+		detail::builder<Result> builder(detail::count_hint(collection, tag()));
+
+		detail::for_each(collection, tag(), [&](id first, auto... rest) {
+			builder.add(first, transform(first, rest...));
+		});
+
+		return builder.finish();
+	}
+
+	/** Returns a new collection containing the non-`nil` results of calling the given transformation with each element of a collection.
+	 *
+	 * @param collection    The collection to map.
+	 * @param transform     A callable that accepts an element, or a key and value, and returns an object or `nil`.
+	 *
+	 * @return              A new collection, an `NSArray` unless otherwise specified, of the non-`nil` results of calling `transform`.
+	 */
+	template <class Result = NSArray *, class Collection, class Transform>
+	inline Result compactMap(Collection collection, Transform &&transform)
+	{
+		using tag = detail::tag_t<Collection>;
+		detail::builder<Result> builder(detail::count_hint(collection, tag()));
+
+		detail::for_each(collection, tag(), [&](id first, auto... rest) {
+			id mapping = transform(first, rest...);
+			if ( mapping ) { builder.add(first, mapping); }
+		});
+
+		return builder.finish();
+	}
+
+
+	#pragma mark - Filtering
+
+	/** Returns a new collection containing the elements of a collection that satisfy the given predicate.
+	 *
+	 * @param collection    The collection to filter.
+	 * @param predicate     A callable that accepts an element, or a key and value, and returns whether it should be included.
+	 *
+	 * @return              A new collection, of the same kind as `collection` unless otherwise specified, of the elements that `predicate` allows.
+	 */
+	template <class Result = void, class Collection, class Predicate>
+	inline detail::filter_result_t<Result, Collection> filter(Collection collection, Predicate &&predicate)
+	{
+		using tag = detail::tag_t<Collection>;
+		detail::builder<detail::filter_result_t<Result, Collection>> builder(detail::count_hint(collection, tag()));
+
+		detail::for_each(collection, tag(), [&](auto... arguments) {
+			if ( predicate(arguments...) ) { builder.add(arguments...); }
+		});
+
+		return builder.finish();
+	}
+
+
+	#pragma mark - Reducing
+
+	/** Returns the result of combining the elements of a collection using the given callable.
+	 *
+	 * The accumulated value may be of any type, including unboxed scalars.
+	 *
+	 * @param collection    The collection to reduce.
+	 * @param initial       The value to use as the initial accumulating value.
+	 * @param combine       A callable that accepts the accumulated value and an element, or a key and value, and returns a new accumulated value.
+	 *
+	 * @return              The final accumulated value. If the collection has no elements, the result is `initial`.
+	 */
+	template <class Collection, class Accumulator, class Combine>
+	inline Accumulator reduce(Collection collection, Accumulator initial, Combine &&combine)
+	{
+		using tag = detail::tag_t<Collection>;
+		Accumulator accumulated = std::move(initial);
+
+		detail::for_each(collection, tag(), [&](auto... arguments) {
+			accumulated = combine(std::move(accumulated), arguments...);
+		});
+
+		return accumulated;
+	}
+}
@@ -18,6 +18,10 @@
 
 @import Foundation;
 
+#import <CBHMapReduceKit/CBHJoinOptions.h>
+#import <CBHMapReduceKit/CBHMapReduceExecutor.h>
+#import <CBHMapReduceKit/CBHArrayView.h>
+
 
 NS_ASSUME_NONNULL_BEGIN
 
@@ -41,6 +45,15 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (NSMutableArray<id> *)mutableArrayByMapping:(nullable id (^)(ElementType object))transform;
 
+/** Returns a new array containing the non-`nil` results of calling the given transformation with each element of this sequence, transforming the elements concurrently.
+ *
+ * @param transform     A closure that accepts an element of this sequence as its parameter and returns a transformed value of the same or of a different type. It may be called concurrently from multiple threads.
+ * @param executor      The executor that schedules the transformations.
+ *
+ * @return              A new array of the non-`nil` results of calling `transform` with each element of the sequence, in the order of the sequence.
+ */
+- (NSArray<id> *)arrayByMapping:(nullable id (^)(ElementType object))transform executor:(CBHMapReduceExecutor *)executor;
+
 
 /** Returns a new set containing the non-`nil` results of calling the given transformation with each element of this sequence.
  *
@@ -94,6 +107,24 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (NSMutableArray<ElementType> *)mutableArrayByFiltering:(BOOL (^)(ElementType object))predicate;
 
+/** Returns a new array containing the elements of the array that satisfy the given predicate, evaluating the predicate concurrently.
+ *
+ * @param predicate     A closure that takes an element as its argument and returns a Boolean value indicating whether the element should be included in the returned array. It may be called concurrently from multiple threads.
+ * @param executor      The executor that schedules the evaluations.
+ *
+ * @return              A new array of the elements that `predicate` allows, in the order of the array.
+ */
+- (NSArray<ElementType> *)arrayByFiltering:(BOOL (^)(ElementType object))predicate executor:(CBHMapReduceExecutor *)executor;
+
+/** Returns a new mutable array containing the elements of the array that satisfy the given predicate, evaluating the predicate concurrently.
+ *
+ * @param predicate     A closure that takes an element as its argument and returns a Boolean value indicating whether the element should be included in the returned array. It may be called concurrently from multiple threads.
+ * @param executor      The executor that schedules the evaluations.
+ *
+ * @return              A new mutable array of the elements that `predicate` allows, in the order of the array.
+ */
+- (NSMutableArray<ElementType> *)mutableArrayByFiltering:(BOOL (^)(ElementType object))predicate executor:(CBHMapReduceExecutor *)executor;
+
 
 #pragma mark - Reducing
 
@@ -106,6 +137,277 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (nullable id)initial:(nullable id)initial reduce:(nullable id (^)(id __nullable accumulated, ElementType object))reduce;
 
+/** Returns the result of combining the elements of the array using the given associative closure, computed concurrently.
+ *
+ * Each chunk of the array is reduced on its own and the results of the chunks are then combined in order, starting from `initial`.
+ *
+ * @param initial   The value to use as the initial accumulating value.
+ * @param combine   An associative closure that returns the combination of two accumulated values, where elements are themselves accumulated values. It may be called concurrently from multiple threads.
+ * @param executor  The executor to run the chunks on.
+ *
+ * @return          The final accumulated value. If the array has no elements, the result is `initial`.
+ */
+- (nullable id)initial:(nullable id)initial associativeReduce:(nullable id (^)(id __nullable lhs, id rhs))combine executor:(CBHMapReduceExecutor *)executor;
+
+
+#pragma mark - Scanning
+
+/** Returns the running results of combining the elements of the sequence using the given closure.
+ *
+ * @param initial   The value to use as the initial accumulating value.
+ * @param scan      A closure that returns a new accumulating value resultant from the combination of whats already been accumulated with an element of the sequence.
+ *
+ * @return          A new array whose element at each index is the value accumulated up to and including the element at that index, or `NSNull` where it is `nil`.
+ */
+- (NSArray<id> *)initial:(nullable id)initial scan:(nullable id (^)(id __nullable accumulated, ElementType object))scan;
+
+/** Returns the running results of combining the elements of the sequence using the given closure, excluding each element from its own result.
+ *
+ * @param initial   The value to use as the initial accumulating value.
+ * @param scan      A closure that returns a new accumulating value resultant from the combination of whats already been accumulated with an element of the sequence.
+ *
+ * @return          A new array whose element at each index is the value accumulated before the element at that index, beginning with `initial`, or `NSNull` where it is `nil`.
+ */
+- (NSArray<id> *)initial:(nullable id)initial exclusiveScan:(nullable id (^)(id __nullable accumulated, ElementType object))scan;
+
+/** Returns the running results of combining the elements of the sequence into an unboxed double using the given closure.
+ *
+ * @param initial   The value to use as the initial accumulating value.
+ * @param scan      A closure that returns a new accumulating value resultant from the combination of whats already been accumulated with an element of the sequence.
+ *
+ * @return          A new data object of packed doubles whose value at each index is the value accumulated up to and including the element at that index.
+ */
+- (NSData *)initialDouble:(double)initial scan:(double (^)(double accumulated, ElementType object))scan;
+
+/** Returns the running results of combining the elements of the sequence into an unboxed double using the given closure, excluding each element from its own result.
+ *
+ * @param initial   The value to use as the initial accumulating value.
+ * @param scan      A closure that returns a new accumulating value resultant from the combination of whats already been accumulated with an element of the sequence.
+ *
+ * @return          A new data object of packed doubles whose value at each index is the value accumulated before the element at that index, beginning with `initial`.
+ */
+- (NSData *)initialDouble:(double)initial exclusiveScan:(double (^)(double accumulated, ElementType object))scan;
+
+/** Returns the running results of combining the elements of the array using the given associative closure, computed concurrently.
+ *
+ * Each chunk of the array is scanned on its own, the totals of the chunks are combined serially, and then each chunk is offset by
+ * the total of the chunks before it.
+ *
+ * @param initial   The value to use as the initial accumulating value.
+ * @param combine   An associative closure that returns the combination of two accumulated values, where elements are themselves accumulated values.
+ * @param executor  The executor to run the chunks on.
+ *
+ * @return          A new array whose element at each index is the value accumulated up to and including the element at that index, or `NSNull` where it is `nil`.
+ */
+- (NSArray<id> *)initial:(nullable id)initial associativeScan:(nullable id (^)(id __nullable lhs, id __nullable rhs))combine executor:(CBHMapReduceExecutor *)executor;
+
+/** Returns the running results of combining the values of the elements of the array into an unboxed double using the given associative closure, computed concurrently.
+ *
+ * @param initial   The value to use as the initial accumulating value.
+ * @param value     A closure that returns the value of an element of the array.
+ * @param combine   An associative closure that returns the combination of two accumulated values.
+ * @param executor  The executor to run the chunks on.
+ *
+ * @return          A new data object of packed doubles whose value at each index is the value accumulated up to and including the element at that index.
+ */
+- (NSData *)initialDouble:(double)initial value:(double (^)(ElementType object))value associativeScan:(double (^)(double lhs, double rhs))combine executor:(CBHMapReduceExecutor *)executor;
+
+
+#pragma mark - Windowing
+
+/** Returns the consecutive chunks of the sequence.
+ *
+ * @param size      The number of elements in each chunk. The final chunk may have fewer.
+ *
+ * @return          A new array of arrays that are views of the elements rather than copies.
+ */
+- (NSArray<NSArray<ElementType> *> *)chunksOfSize:(NSUInteger)size;
+
+/** Returns the full windows of the sequence.
+ *
+ * @param size      The number of elements in each window.
+ * @param step      The number of elements between the starts of consecutive windows.
+ *
+ * @return          A new array of arrays that are views of the elements rather than copies.
+ */
+- (NSArray<NSArray<ElementType> *> *)windowsOfSize:(NSUInteger)size step:(NSUInteger)step;
+
+/** Returns the result of combining the elements of each full window of the sequence, sliding the window one element at a time.
+ *
+ * Each slide adds the element entering the window and removes the element leaving it, so it costs O(1) however large the window.
+ *
+ * @param size      The number of elements in each window.
+ * @param initial   The value to use as the initial accumulating value.
+ * @param add       A closure that returns the accumulating value with an element added.
+ * @param remove    A closure that returns the accumulating value with an element, previously added, removed.
+ *
+ * @return          A new array of the accumulated value of each window, or `NSNull` where it is `nil`.
+ */
+- (NSArray<id> *)windowedReduceOfSize:(NSUInteger)size initial:(nullable id)initial add:(nullable id (^)(id __nullable accumulated, ElementType object))add remove:(nullable id (^)(id __nullable accumulated, ElementType object))remove;
+
+/** Returns the result of combining the elements of each full window of the sequence into an unboxed double, sliding the window one element at a time.
+ *
+ * @param size      The number of elements in each window.
+ * @param initial   The value to use as the initial accumulating value.
+ * @param add       A closure that returns the accumulating value with an element added.
+ * @param remove    A closure that returns the accumulating value with an element, previously added, removed.
+ *
+ * @return          A new data object of the packed double accumulated for each window.
+ */
+- (NSData *)windowedReduceOfSize:(NSUInteger)size initialDouble:(double)initial add:(double (^)(double accumulated, ElementType object))add remove:(double (^)(double accumulated, ElementType object))remove;
+
+
+#pragma mark - Joining
+
+/** Returns a new array containing the non-`nil` results of combining each pair of elements from the receiver and another collection whose keys are equal.
+ *
+ * A hash table is built over the smaller of the two collections and the larger one is streamed through it. The results follow the order of the receiver, with the matches of each element in the order of `other`.
+ *
+ * @param other         The collection to join the receiver with.
+ * @param leftKey       A closure that returns the key of an element of the receiver. Elements with a `nil` key are never matched.
+ * @param rightKey      A closure that returns the key of an element of `other`. Elements with a `nil` key are never matched.
+ * @param combine       A closure that accepts a matching pair of elements and returns a combined value.
+ *
+ * @return              A new array of the non-`nil` results of calling `combine` with each matching pair.
+ */
+- (NSArray<id> *)joinWith:(id<NSFastEnumeration>)other leftKey:(nullable id (^)(ElementType object))leftKey rightKey:(nullable id (^)(id object))rightKey combine:(nullable id (^)(ElementType left, id right))combine;
+
+/** Returns a new array containing the non-`nil` results of combining each pair of elements from the receiver and another collection whose keys are equal.
+ *
+ * A hash table is built over the smaller of the two collections and the larger one is streamed through it. The results follow the order of the receiver, with the matches of each element in the order of `other`.
+ *
+ * @param other         The collection to join the receiver with.
+ * @param leftKey       A closure that returns the key of an element of the receiver. Elements with a `nil` key are never matched.
+ * @param rightKey      A closure that returns the key of an element of `other`. Elements with a `nil` key are never matched.
+ * @param options       The options to perform the join with.
+ * @param combine       A closure that accepts a matching pair of elements and returns a combined value.
+ *
+ * @return              A new array of the non-`nil` results of calling `combine` with each matching pair.
+ */
+- (NSArray<id> *)joinWith:(id<NSFastEnumeration>)other leftKey:(nullable id (^)(ElementType object))leftKey rightKey:(nullable id (^)(id object))rightKey options:(CBHJoinOptions)options combine:(nullable id (^)(ElementType left, id right))combine;
+
+/** Returns a new array containing the non-`nil` results of combining each pair of elements from the receiver and another collection whose keys are equal.
+ *
+ * A hash table is built over the smaller of the two collections and the larger one is streamed through it. The results follow the order of the receiver, with the matches of each element in the order of `other`.
+ *
+ * @param other         The collection to join the receiver with.
+ * @param leftKey       A closure that returns the key of an element of the receiver. Elements with a `nil` key are never matched.
+ * @param rightKey      A closure that returns the key of an element of `other`. Elements with a `nil` key are never matched.
+ * @param executor      The executor that probes partitions of the streamed collection concurrently. The key and combine closures may be called concurrently from multiple threads.
+ * @param combine       A closure that accepts a matching pair of elements and returns a combined value.
+ *
+ * @return              A new array of the non-`nil` results of calling `combine` with each matching pair.
+ */
+- (NSArray<id> *)joinWith:(id<NSFastEnumeration>)other leftKey:(nullable id (^)(ElementType object))leftKey rightKey:(nullable id (^)(id object))rightKey executor:(CBHMapReduceExecutor *)executor combine:(nullable id (^)(ElementType left, id right))combine;
+
+
+/** Returns a new array containing the non-`nil` results of combining each element of the receiver with the elements of another collection whose keys are equal.
+ *
+ * Elements of the receiver without a match are combined with `nil`.
+ *
+ * @param other         The collection to join the receiver with.
+ * @param leftKey       A closure that returns the key of an element of the receiver. Elements with a `nil` key are never matched.
+ * @param rightKey      A closure that returns the key of an element of `other`. Elements with a `nil` key are never matched.
+ * @param combine       A closure that accepts an element of the receiver and its match, or `nil`, and returns a combined value.
+ *
+ * @return              A new array of the non-`nil` results of calling `combine` with each element of the receiver and its matches.
+ */
+- (NSArray<id> *)leftOuterJoinWith:(id<NSFastEnumeration>)other leftKey:(nullable id (^)(ElementType object))leftKey rightKey:(nullable id (^)(id object))rightKey combine:(nullable id (^)(ElementType left, id __nullable right))combine;
+
+/** Returns a new array containing the non-`nil` results of combining each element of the receiver with the elements of another collection whose keys are equal.
+ *
+ * Elements of the receiver without a match are combined with `nil`.
+ *
+ * @param other         The collection to join the receiver with.
+ * @param leftKey       A closure that returns the key of an element of the receiver. Elements with a `nil` key are never matched.
+ * @param rightKey      A closure that returns the key of an element of `other`. Elements with a `nil` key are never matched.
+ * @param options       The options to perform the join with.
+ * @param combine       A closure that accepts an element of the receiver and its match, or `nil`, and returns a combined value.
+ *
+ * @return              A new array of the non-`nil` results of calling `combine` with each element of the receiver and its matches.
+ */
+- (NSArray<id> *)leftOuterJoinWith:(id<NSFastEnumeration>)other leftKey:(nullable id (^)(ElementType object))leftKey rightKey:(nullable id (^)(id object))rightKey options:(CBHJoinOptions)options combine:(nullable id (^)(ElementType left, id __nullable right))combine;
+
+/** Returns a new array containing the non-`nil` results of combining each element of the receiver with the elements of another collection whose keys are equal.
+ *
+ * Elements of the receiver without a match are combined with `nil`.
+ *
+ * @param other         The collection to join the receiver with.
+ * @param leftKey       A closure that returns the key of an element of the receiver. Elements with a `nil` key are never matched.
+ * @param rightKey      A closure that returns the key of an element of `other`. Elements with a `nil` key are never matched.
+ * @param executor      The executor that probes partitions of the streamed collection concurrently. The key and combine closures may be called concurrently from multiple threads.
+ * @param combine       A closure that accepts an element of the receiver and its match, or `nil`, and returns a combined value.
+ *
+ * @return              A new array of the non-`nil` results of calling `combine` with each element of the receiver and its matches.
+ */
+- (NSArray<id> *)leftOuterJoinWith:(id<NSFastEnumeration>)other leftKey:(nullable id (^)(ElementType object))leftKey rightKey:(nullable id (^)(id object))rightKey executor:(CBHMapReduceExecutor *)executor combine:(nullable id (^)(ElementType left, id __nullable right))combine;
+
+
+/** Returns a new array containing the elements of the receiver that have at least one element in another collection with an equal key.
+ *
+ * @param other         The collection to join the receiver with.
+ * @param leftKey       A closure that returns the key of an element of the receiver. Elements with a `nil` key are never matched.
+ * @param rightKey      A closure that returns the key of an element of `other`. Elements with a `nil` key are never matched.
+ *
+ * @return              A new array of the elements of the receiver that have a match.
+ */
+- (NSArray<ElementType> *)semiJoinWith:(id<NSFastEnumeration>)other leftKey:(nullable id (^)(ElementType object))leftKey rightKey:(nullable id (^)(id object))rightKey;
+
+/** Returns a new array containing the elements of the receiver that have at least one element in another collection with an equal key.
+ *
+ * @param other         The collection to join the receiver with.
+ * @param leftKey       A closure that returns the key of an element of the receiver. Elements with a `nil` key are never matched.
+ * @param rightKey      A closure that returns the key of an element of `other`. Elements with a `nil` key are never matched.
+ * @param options       The options to perform the join with.
+ *
+ * @return              A new array of the elements of the receiver that have a match.
+ */
+- (NSArray<ElementType> *)semiJoinWith:(id<NSFastEnumeration>)other leftKey:(nullable id (^)(ElementType object))leftKey rightKey:(nullable id (^)(id object))rightKey options:(CBHJoinOptions)options;
+
+/** Returns a new array containing the elements of the receiver that have at least one element in another collection with an equal key.
+ *
+ * @param other         The collection to join the receiver with.
+ * @param leftKey       A closure that returns the key of an element of the receiver. Elements with a `nil` key are never matched.
+ * @param rightKey      A closure that returns the key of an element of `other`. Elements with a `nil` key are never matched.
+ * @param executor      The executor that probes partitions of the streamed collection concurrently. The key closures may be called concurrently from multiple threads.
+ *
+ * @return              A new array of the elements of the receiver that have a match.
+ */
+- (NSArray<ElementType> *)semiJoinWith:(id<NSFastEnumeration>)other leftKey:(nullable id (^)(ElementType object))leftKey rightKey:(nullable id (^)(id object))rightKey executor:(CBHMapReduceExecutor *)executor;
+
+
+/** Returns a new array containing the elements of the receiver that have no element in another collection with an equal key.
+ *
+ * @param other         The collection to join the receiver with.
+ * @param leftKey       A closure that returns the key of an element of the receiver. Elements with a `nil` key are never matched.
+ * @param rightKey      A closure that returns the key of an element of `other`. Elements with a `nil` key are never matched.
+ *
+ * @return              A new array of the elements of the receiver that have no match.
+ */
+- (NSArray<ElementType> *)antiJoinWith:(id<NSFastEnumeration>)other leftKey:(nullable id (^)(ElementType object))leftKey rightKey:(nullable id (^)(id object))rightKey;
+
+/** Returns a new array containing the elements of the receiver that have no element in another collection with an equal key.
+ *
+ * @param other         The collection to join the receiver with.
+ * @param leftKey       A closure that returns the key of an element of the receiver. Elements with a `nil` key are never matched.
+ * @param rightKey      A closure that returns the key of an element of `other`. Elements with a `nil` key are never matched.
+ * @param options       The options to perform the join with.
+ *
+ * @return              A new array of the elements of the receiver that have no match.
+ */
+- (NSArray<ElementType> *)antiJoinWith:(id<NSFastEnumeration>)other leftKey:(nullable id (^)(ElementType object))leftKey rightKey:(nullable id (^)(id object))rightKey options:(CBHJoinOptions)options;
+
+/** Returns a new array containing the elements of the receiver that have no element in another collection with an equal key.
+ *
+ * @param other         The collection to join the receiver with.
+ * @param leftKey       A closure that returns the key of an element of the receiver. Elements with a `nil` key are never matched.
+ * @param rightKey      A closure that returns the key of an element of `other`. Elements with a `nil` key are never matched.
+ * @param executor      The executor that probes partitions of the streamed collection concurrently. The key closures may be called concurrently from multiple threads.
+ *
+ * @return              A new array of the elements of the receiver that have no match.
+ */
+- (NSArray<ElementType> *)antiJoinWith:(id<NSFastEnumeration>)other leftKey:(nullable id (^)(ElementType object))leftKey rightKey:(nullable id (^)(id object))rightKey executor:(CBHMapReduceExecutor *)executor;
+
 
 #pragma mark - Collection Conversion
 
@@ -172,6 +474,34 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (instancetype)filter:(BOOL (^)(ElementType object))predicate;
 
+/** Filters the receiving array so that it contains only the elements that satisfy the given predicate, evaluating the predicate concurrently.
+ *
+ * @param predicate     A closure that takes an element as its argument and returns a Boolean value indicating whether the element should be kept. It may be called concurrently from multiple threads.
+ * @param executor      The executor that schedules the evaluations.
+ *
+ * @return              The receiver.
+ */
+- (instancetype)filter:(BOOL (^)(ElementType object))predicate executor:(CBHMapReduceExecutor *)executor;
+
+
+#pragma mark - Views
+
+/** Creates a live view of the elements of the receiver that satisfy the given predicate.
+ *
+ * @param predicate     A closure that takes an element as its argument and returns a Boolean value indicating whether the element should be included.
+ *
+ * @return              A view that is updated by mutations made through its `mutableSource`.
+ */
+- (CBHArrayView<ElementType> *)filteredViewUsingPredicate:(BOOL (^)(ElementType object))predicate;
+
+/** Creates a live view of the non-`nil` results of a given closure over each of the receiver's elements.
+ *
+ * @param transform     A closure that accepts an element of the receiver as its parameter and returns a transformed value or `nil` to exclude it.
+ *
+ * @return              A view that is updated by mutations made through its `mutableSource`.
+ */
+- (CBHArrayView<id> *)mappedViewUsingTransform:(nullable id (^)(ElementType object))transform;
+
 @end
 
 NS_ASSUME_NONNULL_END
@@ -18,6 +18,20 @@
 
 #import "NSArray+CBHMapReduceKit.h"
 
+#import "_CBHArrayView.h"
+#import "_CBHFilter.h"
+#import "_CBHMapReduceInstrumentation.h"
+#import "_CBHMapReduceJoin.h"
+#import "_CBHWindows.h"
+
+
+/// The number of elements scanned per chunk by the concurrent scans so each worker is given several chunks.
+static inline NSUInteger CBHScanChunkLength(NSUInteger count, NSUInteger workerCount)
+{
+	NSUInteger chunkCount = MAX(workerCount, (NSUInteger)1) * 4;
+	return MAX((count + chunkCount - 1) / chunkCount, (NSUInteger)4096);
+}
+
 
 @implementation NSArray (CBHMapReduceKit)
 
@@ -25,11 +39,15 @@
 
 - (NSArray *)arrayByMapping:(id (^)(id object))transform
 {
+	CBH_INSTRUMENT(@"NSArray", transform, [self arrayByMapping:transform]);
+
 	return [self mutableArrayByMapping:transform];
 }
 
 - (NSMutableArray *)mutableArrayByMapping:(id (^)(id object))transform
 {
+	CBH_INSTRUMENT(@"NSArray", transform, [self mutableArrayByMapping:transform]);
+
 	NSMutableArray *result = [[NSMutableArray alloc] initWithCapacity:[self count]];
 
 	for (id object in self)
@@ -43,14 +61,51 @@
 	return result;
 }
 
+- (NSArray *)arrayByMapping:(id (^)(id object))transform executor:(CBHMapReduceExecutor *)executor
+{
+	CBH_INSTRUMENT(@"NSArray", transform, [self arrayByMapping:transform executor:executor]);
+
+	NSUInteger count = [self count];
+	__strong id *mappings = (__strong id *)calloc(count, sizeof(id));
+
+	[executor applyRangesOfCount:count block:^(NSRange range) {
+		for (NSUInteger i = range.location; i < NSMaxRange(range); ++i)
+		{
+			mappings[i] = transform([self objectAtIndex:i]);
+		}
+	}];
+
+	NSUInteger kept = 0;
+
+	for (NSUInteger i = 0; i < count; ++i)
+	{
+		id mapping = mappings[i];
+		if ( !mapping ) { continue; }
+
+		mappings[i] = nil;
+		mappings[kept++] = mapping;
+	}
+
+	NSArray *result = [[NSArray alloc] initWithObjects:mappings count:kept];
+
+	for (NSUInteger i = 0; i < kept; ++i) { mappings[i] = nil; }
+	free(mappings);
+
+	return result;
+}
+
 
 - (NSSet *)setByMapping:(id (^)(id object))transform
 {
+	CBH_INSTRUMENT(@"NSArray", transform, [self setByMapping:transform]);
+
 	return [self mutableSetByMapping:transform];
 }
 
 - (NSMutableSet *)mutableSetByMapping:(id (^)(id object))transform
 {
+	CBH_INSTRUMENT(@"NSArray", transform, [self mutableSetByMapping:transform]);
+
 	NSMutableSet *result = [[NSMutableSet alloc] initWithCapacity:[self count]];
 
 	for (id object in self)
@@ -67,11 +122,15 @@
 
 - (NSOrderedSet *)orderedSetByMapping:(id (^)(id object))transform
 {
+	CBH_INSTRUMENT(@"NSArray", transform, [self orderedSetByMapping:transform]);
+
 	return [self mutableOrderedSetByMapping:transform];
 }
 
 - (NSMutableOrderedSet *)mutableOrderedSetByMapping:(id (^)(id object))transform
 {
+	CBH_INSTRUMENT(@"NSArray", transform, [self mutableOrderedSetByMapping:transform]);
+
 	NSMutableOrderedSet *result = [[NSMutableOrderedSet alloc] initWithCapacity:[self count]];
 
 	for (id object in self)
@@ -90,11 +149,15 @@
 
 - (NSArray *)arrayByFiltering:(BOOL (^)(id object))predicate
 {
+	CBH_INSTRUMENT(@"NSArray", predicate, [self arrayByFiltering:predicate]);
+
 	return [self mutableArrayByFiltering:predicate];
 }
 
 - (NSMutableArray *)mutableArrayByFiltering:(BOOL (^)(id object))predicate
 {
+	CBH_INSTRUMENT(@"NSArray", predicate, [self mutableArrayByFiltering:predicate]);
+
 	NSMutableArray *result = [[NSMutableArray alloc] initWithCapacity:[self count]];
 
 	for (id object in self)
@@ -106,11 +169,27 @@
 	return result;
 }
 
+- (NSArray *)arrayByFiltering:(BOOL (^)(id object))predicate executor:(CBHMapReduceExecutor *)executor
+{
+	CBH_INSTRUMENT(@"NSArray", predicate, [self arrayByFiltering:predicate executor:executor]);
+
+	return CBHFilterConcurrently(self, predicate, executor, [NSArray class]);
+}
+
+- (NSMutableArray *)mutableArrayByFiltering:(BOOL (^)(id object))predicate executor:(CBHMapReduceExecutor *)executor
+{
+	CBH_INSTRUMENT(@"NSArray", predicate, [self mutableArrayByFiltering:predicate executor:executor]);
+
+	return CBHFilterConcurrently(self, predicate, executor, [NSMutableArray class]);
+}
+
 
 #pragma mark - Reducing
 
 - (id)initial:(id)initial reduce:(id (^)(id accumulated, id object))reduce
 {
+	CBH_INSTRUMENT(@"NSArray", reduce, [self initial:initial reduce:reduce]);
+
 	id accumulated = initial;
 
 	for (id object in self)
@@ -121,6 +200,407 @@
 	return accumulated;
 }
 
+- (id)initial:(id)initial associativeReduce:(id (^)(id lhs, id rhs))combine executor:(CBHMapReduceExecutor *)executor
+{
+	CBH_INSTRUMENT(@"NSArray", combine, [self initial:initial associativeReduce:combine executor:executor]);
+
+	NSUInteger count = [self count];
+	NSUInteger chunkCount = MIN(count, [executor workerCount] * 4);
+
+	if ( chunkCount < 2 ) { return [self initial:initial reduce:combine]; }
+
+	NSUInteger chunkLength = (count + chunkCount - 1) / chunkCount;
+	chunkCount = (count + chunkLength - 1) / chunkLength;
+
+	__strong id *partials = (__strong id *)calloc(chunkCount, sizeof(id));
+
+	/// Reduce each chunk on its own from its first element.
+	[executor applyRangesOfCount:chunkCount block:^(NSRange range) {
+		for (NSUInteger chunk = range.location; chunk < NSMaxRange(range); ++chunk)
+		{
+			NSUInteger start = chunk * chunkLength;
+			NSUInteger end = MIN(start + chunkLength, count);
+
+			id partial = [self objectAtIndex:start];
+
+			for (NSUInteger i = start + 1; i < end; ++i)
+			{
+				partial = combine(partial, [self objectAtIndex:i]);
+			}
+
+			partials[chunk] = partial;
+		}
+	}];
+
+	id accumulated = initial;
+
+	for (NSUInteger chunk = 0; chunk < chunkCount; ++chunk)
+	{
+		accumulated = combine(accumulated, partials[chunk]);
+		partials[chunk] = nil;
+	}
+
+	free(partials);
+
+	return accumulated;
+}
+
+
+#pragma mark - Scanning
+
+- (NSArray *)initial:(id)initial scan:(id (^)(id accumulated, id object))scan
+{
+	CBH_INSTRUMENT(@"NSArray", scan, [self initial:initial scan:scan]);
+
+	NSMutableArray *scans = [[NSMutableArray alloc] initWithCapacity:[self count]];
+	id accumulated = initial;
+
+	for (id object in self)
+	{
+		accumulated = scan(accumulated, object);
+		[scans addObject:accumulated ?: [NSNull null]];
+	}
+
+	return scans;
+}
+
+- (NSArray *)initial:(id)initial exclusiveScan:(id (^)(id accumulated, id object))scan
+{
+	CBH_INSTRUMENT(@"NSArray", scan, [self initial:initial exclusiveScan:scan]);
+
+	NSMutableArray *scans = [[NSMutableArray alloc] initWithCapacity:[self count]];
+	id accumulated = initial;
+
+	for (id object in self)
+	{
+		[scans addObject:accumulated ?: [NSNull null]];
+		accumulated = scan(accumulated, object);
+	}
+
+	return scans;
+}
+
+- (NSData *)initialDouble:(double)initial scan:(double (^)(double accumulated, id object))scan
+{
+	CBH_INSTRUMENT(@"NSArray", scan, [self initialDouble:initial scan:scan]);
+
+	NSUInteger count = [self count];
+	double *scans = (double *)malloc(count * sizeof(double));
+	double accumulated = initial;
+	NSUInteger index = 0;
+
+	for (id object in self)
+	{
+		accumulated = scan(accumulated, object);
+		scans[index++] = accumulated;
+	}
+
+	return [[NSData alloc] initWithBytesNoCopy:scans length:count * sizeof(double) freeWhenDone:YES];
+}
+
+- (NSData *)initialDouble:(double)initial exclusiveScan:(double (^)(double accumulated, id object))scan
+{
+	CBH_INSTRUMENT(@"NSArray", scan, [self initialDouble:initial exclusiveScan:scan]);
+
+	NSUInteger count = [self count];
+	double *scans = (double *)malloc(count * sizeof(double));
+	double accumulated = initial;
+	NSUInteger index = 0;
+
+	for (id object in self)
+	{
+		scans[index++] = accumulated;
+		accumulated = scan(accumulated, object);
+	}
+
+	return [[NSData alloc] initWithBytesNoCopy:scans length:count * sizeof(double) freeWhenDone:YES];
+}
+
+- (NSArray *)initial:(id)initial associativeScan:(id (^)(id lhs, id rhs))combine executor:(CBHMapReduceExecutor *)executor
+{
+	CBH_INSTRUMENT(@"NSArray", combine, [self initial:initial associativeScan:combine executor:executor]);
+
+	NSUInteger count = [self count];
+	NSUInteger chunkLength = CBHScanChunkLength(count, [executor workerCount]);
+	NSUInteger chunkCount = (count + chunkLength - 1) / chunkLength;
+
+	if ( chunkCount < 2 ) { return [self initial:initial scan:combine]; }
+
+	__strong id *scans = (__strong id *)calloc(count, sizeof(id));
+	__strong id *partials = (__strong id *)calloc(chunkCount, sizeof(id));
+
+	/// Scan each chunk on its own, the first from `initial` and the rest from their first element.
+	[executor applyRangesOfCount:chunkCount block:^(NSRange range) {
+		for (NSUInteger chunk = range.location; chunk < NSMaxRange(range); ++chunk)
+		{
+			NSUInteger start = chunk * chunkLength;
+			NSUInteger end = MIN(start + chunkLength, count);
+
+			id accumulated = [self objectAtIndex:start];
+			if ( chunk == 0 ) { accumulated = combine(initial, accumulated); }
+			scans[start] = accumulated;
+
+			for (NSUInteger i = start + 1; i < end; ++i)
+			{
+				accumulated = combine(accumulated, [self objectAtIndex:i]);
+				scans[i] = accumulated;
+			}
+
+			partials[chunk] = accumulated;
+		}
+	}];
+
+	/// Replace each partial with the total of the chunks before it.
+	id carry = partials[0];
+
+	for (NSUInteger chunk = 1; chunk < chunkCount; ++chunk)
+	{
+		id partial = partials[chunk];
+		partials[chunk] = carry;
+		carry = combine(carry, partial);
+	}
+
+	[executor applyRangesOfCount:chunkCount - 1 block:^(NSRange range) {
+		for (NSUInteger chunk = range.location + 1; chunk <= NSMaxRange(range); ++chunk)
+		{
+			id offset = partials[chunk];
+			NSUInteger end = MIN((chunk + 1) * chunkLength, count);
+
+			for (NSUInteger i = chunk * chunkLength; i < end; ++i)
+			{
+				scans[i] = combine(offset, scans[i]);
+			}
+		}
+	}];
+
+	/// `nil` stays in the buffer until now so that it is passed to `combine` as it would be by a serial scan.
+	for (NSUInteger i = 0; i < count; ++i)
+	{
+		if ( !scans[i] ) { scans[i] = [NSNull null]; }
+	}
+
+	NSArray *result = [[NSArray alloc] initWithObjects:scans count:count];
+
+	for (NSUInteger i = 0; i < count; ++i) { scans[i] = nil; }
+	for (NSUInteger i = 0; i < chunkCount; ++i) { partials[i] = nil; }
+	free(scans);
+	free(partials);
+
+	return result;
+}
+
+- (NSData *)initialDouble:(double)initial value:(double (^)(id object))value associativeScan:(double (^)(double lhs, double rhs))combine executor:(CBHMapReduceExecutor *)executor
+{
+	CBH_INSTRUMENT_PAIR(@"NSArray", value, combine, [self initialDouble:initial value:value associativeScan:combine executor:executor]);
+
+	NSUInteger count = [self count];
+	NSUInteger chunkLength = CBHScanChunkLength(count, [executor workerCount]);
+	NSUInteger chunkCount = (count + chunkLength - 1) / chunkLength;
+
+	if ( chunkCount < 2 )
+	{
+		return [self initialDouble:initial scan:^double (double accumulated, id object) {
+			return combine(accumulated, value(object));
+		}];
+	}
+
+	double *scans = (double *)malloc(count * sizeof(double));
+	double *partials = (double *)malloc(chunkCount * sizeof(double));
+
+	/// Scan each chunk on its own, the first from `initial` and the rest from their first element.
+	[executor applyRangesOfCount:chunkCount block:^(NSRange range) {
+		for (NSUInteger chunk = range.location; chunk < NSMaxRange(range); ++chunk)
+		{
+			NSUInteger start = chunk * chunkLength;
+			NSUInteger end = MIN(start + chunkLength, count);
+
+			double accumulated = value([self objectAtIndex:start]);
+			if ( chunk == 0 ) { accumulated = combine(initial, accumulated); }
+			scans[start] = accumulated;
+
+			for (NSUInteger i = start + 1; i < end; ++i)
+			{
+				accumulated = combine(accumulated, value([self objectAtIndex:i]));
+				scans[i] = accumulated;
+			}
+
+			partials[chunk] = accumulated;
+		}
+	}];
+
+	/// Replace each partial with the total of the chunks before it.
+	double carry = partials[0];
+
+	for (NSUInteger chunk = 1; chunk < chunkCount; ++chunk)
+	{
+		double partial = partials[chunk];
+		partials[chunk] = carry;
+		carry = combine(carry, partial);
+	}
+
+	[executor applyRangesOfCount:chunkCount - 1 block:^(NSRange range) {
+		for (NSUInteger chunk = range.location + 1; chunk <= NSMaxRange(range); ++chunk)
+		{
+			double offset = partials[chunk];
+			NSUInteger end = MIN((chunk + 1) * chunkLength, count);
+
+			for (NSUInteger i = chunk * chunkLength; i < end; ++i)
+			{
+				scans[i] = combine(offset, scans[i]);
+			}
+		}
+	}];
+
+	free(partials);
+
+	return [[NSData alloc] initWithBytesNoCopy:scans length:count * sizeof(double) freeWhenDone:YES];
+}
+
+
+#pragma mark - Windowing
+
+- (NSArray *)chunksOfSize:(NSUInteger)size
+{
+	CBH_INSTRUMENT_CALL(@"NSArray", [self chunksOfSize:size]);
+
+	return [[CBHWindowArray alloc] initWithSource:[self copy] size:size step:size partial:YES];
+}
+
+- (NSArray *)windowsOfSize:(NSUInteger)size step:(NSUInteger)step
+{
+	CBH_INSTRUMENT_CALL(@"NSArray", [self windowsOfSize:size step:step]);
+
+	return [[CBHWindowArray alloc] initWithSource:[self copy] size:size step:step partial:NO];
+}
+
+- (NSArray *)windowedReduceOfSize:(NSUInteger)size initial:(id)initial add:(id (^)(id accumulated, id object))add remove:(id (^)(id accumulated, id object))remove
+{
+	CBH_INSTRUMENT_PAIR(@"NSArray", add, remove, [self windowedReduceOfSize:size initial:initial add:add remove:remove]);
+
+	CBHWindowValidate(size, 1);
+
+	NSUInteger count = [self count];
+	if ( count < size ) { return [[NSArray alloc] init]; }
+
+	NSMutableArray *reductions = [[NSMutableArray alloc] initWithCapacity:count - size + 1];
+	id accumulated = initial;
+
+	for (NSUInteger i = 0; i < size; ++i)
+	{
+		accumulated = add(accumulated, [self objectAtIndex:i]);
+	}
+
+	[reductions addObject:accumulated ?: [NSNull null]];
+
+	for (NSUInteger i = size; i < count; ++i)
+	{
+		accumulated = remove(accumulated, [self objectAtIndex:i - size]);
+		accumulated = add(accumulated, [self objectAtIndex:i]);
+		[reductions addObject:accumulated ?: [NSNull null]];
+	}
+
+	return reductions;
+}
+
+- (NSData *)windowedReduceOfSize:(NSUInteger)size initialDouble:(double)initial add:(double (^)(double accumulated, id object))add remove:(double (^)(double accumulated, id object))remove
+{
+	CBH_INSTRUMENT_PAIR(@"NSArray", add, remove, [self windowedReduceOfSize:size initialDouble:initial add:add remove:remove]);
+
+	CBHWindowValidate(size, 1);
+
+	NSUInteger count = [self count];
+	if ( count < size ) { return [[NSData alloc] init]; }
+
+	double *reductions = (double *)malloc((count - size + 1) * sizeof(double));
+	double accumulated = initial;
+
+	for (NSUInteger i = 0; i < size; ++i)
+	{
+		accumulated = add(accumulated, [self objectAtIndex:i]);
+	}
+
+	reductions[0] = accumulated;
+
+	for (NSUInteger i = size; i < count; ++i)
+	{
+		accumulated = remove(accumulated, [self objectAtIndex:i - size]);
+		accumulated = add(accumulated, [self objectAtIndex:i]);
+		reductions[i - size + 1] = accumulated;
+	}
+
+	return [[NSData alloc] initWithBytesNoCopy:reductions length:(count - size + 1) * sizeof(double) freeWhenDone:YES];
+}
+
+
+#pragma mark - Joining
+
+- (NSArray *)joinWith:(id<NSFastEnumeration>)other leftKey:(id (^)(id object))leftKey rightKey:(id (^)(id object))rightKey combine:(id (^)(id left, id right))combine
+{
+	return [self joinWith:other leftKey:leftKey rightKey:rightKey options:CBHJoinOptionsNone combine:combine];
+}
+
+- (NSArray *)joinWith:(id<NSFastEnumeration>)other leftKey:(id (^)(id object))leftKey rightKey:(id (^)(id object))rightKey options:(CBHJoinOptions)options combine:(id (^)(id left, id right))combine
+{
+	CBHMapReduceExecutor *executor = ( options & CBHJoinOptionsConcurrent ) ? [CBHMapReduceExecutor defaultExecutor] : nil;
+	return CBHJoin(CBHJoinKindInner, self, [self count], other, CBHJoinCount(other), leftKey, rightKey, combine, executor);
+}
+
+- (NSArray *)joinWith:(id<NSFastEnumeration>)other leftKey:(id (^)(id object))leftKey rightKey:(id (^)(id object))rightKey executor:(CBHMapReduceExecutor *)executor combine:(id (^)(id left, id right))combine
+{
+	return CBHJoin(CBHJoinKindInner, self, [self count], other, CBHJoinCount(other), leftKey, rightKey, combine, executor);
+}
+
+
+- (NSArray *)leftOuterJoinWith:(id<NSFastEnumeration>)other leftKey:(id (^)(id object))leftKey rightKey:(id (^)(id object))rightKey combine:(id (^)(id left, id right))combine
+{
+	return [self leftOuterJoinWith:other leftKey:leftKey rightKey:rightKey options:CBHJoinOptionsNone combine:combine];
+}
+
+- (NSArray *)leftOuterJoinWith:(id<NSFastEnumeration>)other leftKey:(id (^)(id object))leftKey rightKey:(id (^)(id object))rightKey options:(CBHJoinOptions)options combine:(id (^)(id left, id right))combine
+{
+	CBHMapReduceExecutor *executor = ( options & CBHJoinOptionsConcurrent ) ? [CBHMapReduceExecutor defaultExecutor] : nil;
+	return CBHJoin(CBHJoinKindLeftOuter, self, [self count], other, CBHJoinCount(other), leftKey, rightKey, combine, executor);
+}
+
+- (NSArray *)leftOuterJoinWith:(id<NSFastEnumeration>)other leftKey:(id (^)(id object))leftKey rightKey:(id (^)(id object))rightKey executor:(CBHMapReduceExecutor *)executor combine:(id (^)(id left, id right))combine
+{
+	return CBHJoin(CBHJoinKindLeftOuter, self, [self count], other, CBHJoinCount(other), leftKey, rightKey, combine, executor);
+}
+
+
+- (NSArray *)semiJoinWith:(id<NSFastEnumeration>)other leftKey:(id (^)(id object))leftKey rightKey:(id (^)(id object))rightKey
+{
+	return [self semiJoinWith:other leftKey:leftKey rightKey:rightKey options:CBHJoinOptionsNone];
+}
+
+- (NSArray *)semiJoinWith:(id<NSFastEnumeration>)other leftKey:(id (^)(id object))leftKey rightKey:(id (^)(id object))rightKey options:(CBHJoinOptions)options
+{
+	CBHMapReduceExecutor *executor = ( options & CBHJoinOptionsConcurrent ) ? [CBHMapReduceExecutor defaultExecutor] : nil;
+	return CBHJoin(CBHJoinKindSemi, self, [self count], other, CBHJoinCount(other), leftKey, rightKey, nil, executor);
+}
+
+- (NSArray *)semiJoinWith:(id<NSFastEnumeration>)other leftKey:(id (^)(id object))leftKey rightKey:(id (^)(id object))rightKey executor:(CBHMapReduceExecutor *)executor
+{
+	return CBHJoin(CBHJoinKindSemi, self, [self count], other, CBHJoinCount(other), leftKey, rightKey, nil, executor);
+}
+
+
+- (NSArray *)antiJoinWith:(id<NSFastEnumeration>)other leftKey:(id (^)(id object))leftKey rightKey:(id (^)(id object))rightKey
+{
+	return [self antiJoinWith:other leftKey:leftKey rightKey:rightKey options:CBHJoinOptionsNone];
+}
+
+- (NSArray *)antiJoinWith:(id<NSFastEnumeration>)other leftKey:(id (^)(id object))leftKey rightKey:(id (^)(id object))rightKey options:(CBHJoinOptions)options
+{
+	CBHMapReduceExecutor *executor = ( options & CBHJoinOptionsConcurrent ) ? [CBHMapReduceExecutor defaultExecutor] : nil;
+	return CBHJoin(CBHJoinKindAnti, self, [self count], other, CBHJoinCount(other), leftKey, rightKey, nil, executor);
+}
+
+- (NSArray *)antiJoinWith:(id<NSFastEnumeration>)other leftKey:(id (^)(id object))leftKey rightKey:(id (^)(id object))rightKey executor:(CBHMapReduceExecutor *)executor
+{
+	return CBHJoin(CBHJoinKindAnti, self, [self count], other, CBHJoinCount(other), leftKey, rightKey, nil, executor);
+}
+
 
 #pragma mark - Collection Conversion
 
@@ -131,7 +611,7 @@
 
 - (NSMutableSet *)toMutableSet
 {
-	return [self mutableSetByMapping:^id(id object) { return object; }];
+	return [[NSMutableSet alloc] initWithArray:self];
 }
 
 
@@ -142,7 +622,7 @@
 
 - (NSMutableOrderedSet *)toMutableOrderedSet
 {
-	return [self mutableOrderedSetByMapping:^id(id object) { return object; }];
+	return [[NSMutableOrderedSet alloc] initWithArray:self];
 }
 
 @end
@@ -154,6 +634,8 @@
 
 - (instancetype)map:(id (^)(id object))transform
 {
+	CBH_INSTRUMENT(@"NSMutableArray", transform, [self map:transform]);
+
 	[self enumerateObjectsUsingBlock:^(id object, NSUInteger idx, BOOL *stop) {
 		id mapping = transform(object);
 		if ( object == mapping ) { return; }
@@ -166,6 +648,8 @@
 
 - (instancetype)compactMap:(id (^)(id object))transform
 {
+	CBH_INSTRUMENT(@"NSMutableArray", transform, [self compactMap:transform]);
+
 	NSMutableIndexSet *removals = [NSMutableIndexSet indexSet];
 
 	[self enumerateObjectsUsingBlock:^(id object, NSUInteger idx, BOOL *stop) {
@@ -190,6 +674,8 @@
 
 - (instancetype)filter:(BOOL (^)(id object))predicate
 {
+	CBH_INSTRUMENT(@"NSMutableArray", predicate, [self filter:predicate]);
+
 	NSMutableIndexSet *removals = [NSMutableIndexSet indexSet];
 
 	[self enumerateObjectsUsingBlock:^(id object, NSUInteger idx, BOOL *stop) {
@@ -202,4 +688,29 @@
 	return self;
 }
 
+- (instancetype)filter:(BOOL (^)(id object))predicate executor:(CBHMapReduceExecutor *)executor
+{
+	CBH_INSTRUMENT(@"NSMutableArray", predicate, [self filter:predicate executor:executor]);
+
+	NSArray *survivors = CBHFilterConcurrently(self, predicate, executor, [NSArray class]);
+	if ( [survivors count] != [self count] ) { [self setArray:survivors]; }
+
+	return self;
+}
+
+
+#pragma mark - Views
+
+- (CBHArrayView *)filteredViewUsingPredicate:(BOOL (^)(id object))predicate
+{
+	return [self mappedViewUsingTransform:^id (id object) {
+		return ( predicate(object) ) ? object : nil;
+	}];
+}
+
+- (CBHArrayView *)mappedViewUsingTransform:(id (^)(id object))transform
+{
+	return [[CBHArrayView alloc] initWithSource:self transform:transform];
+}
+
 @end
@@ -18,6 +18,9 @@
 
 @import Foundation;
 
+#import <CBHMapReduceKit/CBHMapReduceExecutor.h>
+#import <CBHMapReduceKit/CBHDictionaryView.h>
+
 
 NS_ASSUME_NONNULL_BEGIN
 
@@ -41,6 +44,15 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (NSMutableDictionary<KeyType, id> *)mutableDictionaryByMapping:(nullable id (^)(KeyType key, ElementType value))transform;
 
+/** Returns a new dictionary containing the keys of the dictionary with the non-`nil` results of calling the given transformation with each key-value pair, transforming the pairs concurrently.
+ *
+ * @param transform     A closure that accepts a key-value pair as its parameters and returns a transformed value of the same or different type. It may be called concurrently from multiple threads.
+ * @param executor      The executor that schedules the transformations.
+ *
+ * @return              A new dictionary of the keys with the non-`nil` results of calling `transform` with each pair.
+ */
+- (NSDictionary<KeyType, id> *)dictionaryByMapping:(nullable id (^)(KeyType key, ElementType value))transform executor:(CBHMapReduceExecutor *)executor;
+
 
 /** Returns a new array containing the non-`nil` results of calling the given transformation with each element of this dictionary.
  *
@@ -111,6 +123,15 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (NSMutableDictionary<KeyType, ElementType> *)mutableDictionaryByFiltering:(BOOL (^)(KeyType key, ElementType value))predicate;
 
+/** Returns a new dictionary containing the elements of the receiver that satisfy the given predicate, evaluating the predicate concurrently.
+ *
+ * @param predicate     A closure that takes a key-value pair as its arguments and returns a Boolean value indicating whether the element should be included in the returned dictionary. It may be called concurrently from multiple threads.
+ * @param executor      The executor that schedules the evaluations.
+ *
+ * @return              A new dictionary of the key-value pairs that `predicate` allows.
+ */
+- (NSDictionary<KeyType, ElementType> *)dictionaryByFiltering:(BOOL (^)(KeyType key, ElementType value))predicate executor:(CBHMapReduceExecutor *)executor;
+
 
 #pragma mark - Reducing
 
@@ -123,6 +144,18 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (id)initial:(id)initial reduce:(id (^)(id accumulated, ElementType object))reduce;
 
+/** Returns the result of combining the values of the dictionary using the given associative closure, computed concurrently.
+ *
+ * Each chunk of the values is reduced on its own and the results of the chunks are then combined, starting from `initial`.
+ *
+ * @param initial   The value to use as the initial accumulating value.
+ * @param combine   An associative closure that returns the combination of two accumulated values, where values are themselves accumulated values. It may be called concurrently from multiple threads.
+ * @param executor  The executor to run the chunks on.
+ *
+ * @return          The final accumulated value. If the dictionary is empty, the result is `initial`.
+ */
+- (nullable id)initial:(nullable id)initial associativeReduce:(nullable id (^)(id __nullable lhs, id rhs))combine executor:(CBHMapReduceExecutor *)executor;
+
 @end
 
 
@@ -181,6 +214,25 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (instancetype)filter:(BOOL (^)(KeyType key, ElementType value))predicate;
 
+
+#pragma mark - Views
+
+/** Creates a live view of the values of the receiver that satisfy the given predicate.
+ *
+ * @param predicate     A closure that takes a key-value pair as its arguments and returns a Boolean value indicating whether the value should be included.
+ *
+ * @return              A view that is updated by mutations made through its `mutableSource`.
+ */
+- (CBHDictionaryView<KeyType, ElementType> *)filteredViewUsingPredicate:(BOOL (^)(KeyType key, ElementType value))predicate;
+
+/** Creates a live view of the non-`nil` results of a given closure over each of the receiver's values.
+ *
+ * @param transform     A closure that accepts a key-value pair of the receiver as its parameters and returns a transformed value or `nil` to exclude it.
+ *
+ * @return              A view that is updated by mutations made through its `mutableSource`.
+ */
+- (CBHDictionaryView<KeyType, id> *)mappedViewUsingTransform:(nullable id (^)(KeyType key, ElementType value))transform;
+
 @end
 
 NS_ASSUME_NONNULL_END
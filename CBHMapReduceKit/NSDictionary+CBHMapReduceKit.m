@@ -18,6 +18,11 @@
 
 #import "NSDictionary+CBHMapReduceKit.h"
 
+#import "NSArray+CBHMapReduceKit.h"
+#import "_CBHDictionaryView.h"
+#import "_CBHFilter.h"
+#import "_CBHMapReduceInstrumentation.h"
+
 
 @implementation NSDictionary (CBHMapReduceKit)
 
@@ -26,11 +31,15 @@
 
 - (NSDictionary *)dictionaryByMapping:(id (^)(id key, id object))transform
 {
+	CBH_INSTRUMENT(@"NSDictionary", transform, [self dictionaryByMapping:transform]);
+
 	return [self mutableDictionaryByMapping:transform];
 }
 
 - (NSMutableDictionary *)mutableDictionaryByMapping:(id (^)(id key, id object))transform
 {
+	CBH_INSTRUMENT(@"NSDictionary", transform, [self mutableDictionaryByMapping:transform]);
+
 	NSMutableDictionary *result = [[NSMutableDictionary alloc] initWithCapacity:[self count]];
 
 	[self enumerateKeysAndObjectsUsingBlock:^(id key, id value, BOOL *stop) {
@@ -41,14 +50,47 @@
 	return result;
 }
 
+- (NSDictionary *)dictionaryByMapping:(id (^)(id key, id object))transform executor:(CBHMapReduceExecutor *)executor
+{
+	CBH_INSTRUMENT(@"NSDictionary", transform, [self dictionaryByMapping:transform executor:executor]);
+
+	NSArray *keys = [self allKeys];
+	NSUInteger count = [keys count];
+	__strong id *mappings = (__strong id *)calloc(count, sizeof(id));
+
+	[executor applyRangesOfCount:count block:^(NSRange range) {
+		for (NSUInteger i = range.location; i < NSMaxRange(range); ++i)
+		{
+			id key = [keys objectAtIndex:i];
+			mappings[i] = transform(key, [self objectForKey:key]);
+		}
+	}];
+
+	NSMutableDictionary *result = [[NSMutableDictionary alloc] initWithCapacity:count];
+
+	for (NSUInteger i = 0; i < count; ++i)
+	{
+		if ( mappings[i] ) { [result setObject:mappings[i] forKey:[keys objectAtIndex:i]]; }
+		mappings[i] = nil;
+	}
+
+	free(mappings);
+
+	return result;
+}
+
 
 - (NSArray *)arrayByMapping:(id (^)(id key, id object))transform
 {
+	CBH_INSTRUMENT(@"NSDictionary", transform, [self arrayByMapping:transform]);
+
 	return [self mutableArrayByMapping:transform];
 }
 
 - (NSMutableArray *)mutableArrayByMapping:(id (^)(id key, id object))transform
 {
+	CBH_INSTRUMENT(@"NSDictionary", transform, [self mutableArrayByMapping:transform]);
+
 	NSMutableArray *result = [[NSMutableArray alloc] initWithCapacity:[self count]];
 
 	[self enumerateKeysAndObjectsUsingBlock:^(id key, id value, BOOL *stop) {
@@ -62,11 +104,15 @@
 
 - (NSSet *)setByMapping:(id (^)(id key, id object))transform
 {
+	CBH_INSTRUMENT(@"NSDictionary", transform, [self setByMapping:transform]);
+
 	return [self mutableSetByMapping:transform];
 }
 
 - (NSMutableSet *)mutableSetByMapping:(id (^)(id key, id object))transform
 {
+	CBH_INSTRUMENT(@"NSDictionary", transform, [self mutableSetByMapping:transform]);
+
 	NSMutableSet *result = [[NSMutableSet alloc] initWithCapacity:[self count]];
 
 	[self enumerateKeysAndObjectsUsingBlock:^(id key, id value, BOOL *stop) {
@@ -80,11 +126,15 @@
 
 - (NSOrderedSet *)orderedSetByMapping:(id (^)(id key, id object))transform
 {
+	CBH_INSTRUMENT(@"NSDictionary", transform, [self orderedSetByMapping:transform]);
+
 	return [self mutableOrderedSetByMapping:transform];
 }
 
 - (NSMutableOrderedSet *)mutableOrderedSetByMapping:(id (^)(id key, id object))transform
 {
+	CBH_INSTRUMENT(@"NSDictionary", transform, [self mutableOrderedSetByMapping:transform]);
+
 	NSMutableOrderedSet *result = [[NSMutableOrderedSet alloc] initWithCapacity:[self count]];
 
 	[self enumerateKeysAndObjectsUsingBlock:^(id key, id value, BOOL *stop) {
@@ -100,11 +150,15 @@
 
 - (NSDictionary *)dictionaryByFiltering:(BOOL (^)(id key, id object))predicate
 {
+	CBH_INSTRUMENT(@"NSDictionary", predicate, [self dictionaryByFiltering:predicate]);
+
 	return [self mutableDictionaryByFiltering:predicate];
 }
 
 - (NSMutableDictionary *)mutableDictionaryByFiltering:(BOOL (^)(id key, id object))predicate
 {
+	CBH_INSTRUMENT(@"NSDictionary", predicate, [self mutableDictionaryByFiltering:predicate]);
+
 	NSMutableDictionary *result = [[NSMutableDictionary alloc] initWithCapacity:[self count]];
 
 	[self enumerateKeysAndObjectsUsingBlock:^(id key, id value, BOOL *stop) {
@@ -114,11 +168,24 @@
 	return result;
 }
 
+- (NSDictionary *)dictionaryByFiltering:(BOOL (^)(id key, id object))predicate executor:(CBHMapReduceExecutor *)executor
+{
+	CBH_INSTRUMENT(@"NSDictionary", predicate, [self dictionaryByFiltering:predicate executor:executor]);
+
+	NSArray *keys = CBHFilterConcurrently([self allKeys], ^BOOL (id key) {
+		return predicate(key, [self objectForKey:key]);
+	}, executor, [NSArray class]);
+
+	return [[NSDictionary alloc] initWithObjects:[self objectsForKeys:keys notFoundMarker:[NSNull null]] forKeys:keys];
+}
+
 
 #pragma mark - Reducing
 
 - (id)initial:(id)initial reduce:(id (^)(id accumulated, id object))reduce
 {
+	CBH_INSTRUMENT(@"NSDictionary", reduce, [self initial:initial reduce:reduce]);
+
 	id accumulated = initial;
 
 	for (id object in [self objectEnumerator])
@@ -129,6 +196,13 @@
 	return accumulated;
 }
 
+- (id)initial:(id)initial associativeReduce:(id (^)(id lhs, id rhs))combine executor:(CBHMapReduceExecutor *)executor
+{
+	CBH_INSTRUMENT(@"NSDictionary", combine, [self initial:initial associativeReduce:combine executor:executor]);
+
+	return [[self allValues] initial:initial associativeReduce:combine executor:executor];
+}
+
 @end
 
 
@@ -138,6 +212,8 @@
 
 - (instancetype)map:(nonnull id (^)(id key, id value))transform
 {
+	CBH_INSTRUMENT(@"NSMutableDictionary", transform, [self map:transform]);
+
 	[self enumerateKeysAndObjectsUsingBlock:^(id key, id value, BOOL *stop) {
 		id mapping = transform(key, value);
 		if ( value == mapping ) { return; }
@@ -150,6 +226,8 @@
 
 - (instancetype)compactMap:(nullable id (^)(id key, id value))transform
 {
+	CBH_INSTRUMENT(@"NSMutableDictionary", transform, [self compactMap:transform]);
+
 	[self enumerateKeysAndObjectsUsingBlock:^(id key, id value, BOOL *stop) {
 		id mapping = transform(key, value);
 		if ( value == mapping ) { return; }
@@ -163,6 +241,8 @@
 
 - (instancetype)rekey:(nonnull id (^)(id key, id value))transform
 {
+	CBH_INSTRUMENT(@"NSMutableDictionary", transform, [self rekey:transform]);
+
 	NSMutableDictionary *additions = [NSMutableDictionary dictionaryWithCapacity:[self count]];
 	NSMutableArray *removals = [NSMutableArray arrayWithCapacity:[self count]];
 
@@ -182,6 +262,8 @@
 
 - (instancetype)compactRekey:(nullable id (^)(id key, id value))transform
 {
+	CBH_INSTRUMENT(@"NSMutableDictionary", transform, [self compactRekey:transform]);
+
 	NSMutableDictionary *additions = [NSMutableDictionary dictionaryWithCapacity:[self count]];
 	NSMutableArray *removals = [NSMutableArray arrayWithCapacity:[self count]];
 
@@ -205,6 +287,8 @@
 
 - (instancetype)filter:(BOOL (^)(id key, id value))predicate
 {
+	CBH_INSTRUMENT(@"NSMutableDictionary", predicate, [self filter:predicate]);
+
 	[self enumerateKeysAndObjectsUsingBlock:^(id key, id value, BOOL *stop) {
 		if ( !predicate(key, value) ) { [self removeObjectForKey:key]; }
 	}];
@@ -212,4 +296,19 @@
 	return self;
 }
 
+
+#pragma mark - Views
+
+- (CBHDictionaryView *)filteredViewUsingPredicate:(BOOL (^)(id key, id value))predicate
+{
+	return [self mappedViewUsingTransform:^id (id key, id value) {
+		return ( predicate(key, value) ) ? value : nil;
+	}];
+}
+
+- (CBHDictionaryView *)mappedViewUsingTransform:(id (^)(id key, id value))transform
+{
+	return [[CBHDictionaryView alloc] initWithSource:self transform:transform];
+}
+
 @end
@@ -18,6 +18,9 @@
 
 @import Foundation;
 
+#import <CBHMapReduceKit/CBHJoinOptions.h>
+#import <CBHMapReduceKit/CBHMapReduceExecutor.h>
+
 
 NS_ASSUME_NONNULL_BEGIN
 
@@ -33,6 +36,15 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (NSArray<id> *)arrayByMapping:(nullable id (^)(ElementType object))transform;
 
+/** Returns a new array containing the non-`nil` results of calling the given transformation with each element of this sequence.
+ *
+ * @param transform     A closure that accepts an element of this sequence as its parameter and returns a transformed value of the same or of a different type.
+ * @param expectedCount The number of elements the result is expected to hold, used to size it up front.
+ *
+ * @return              A new array of the non-`nil` results of calling `transform` with each element of the sequence.
+ */
+- (NSArray<id> *)arrayByMapping:(nullable id (^)(ElementType object))transform expectedCount:(NSUInteger)expectedCount;
+
 /** Returns a new mutable array containing the non-`nil` results of calling the given transformation with each element of this sequence.
  *
  * @param transform     A closure that accepts an element of this sequence as its parameter and returns a transformed value of the same or of a different type.
@@ -41,6 +53,26 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (NSMutableArray<id> *)mutableArrayByMapping:(nullable id (^)(ElementType object))transform;
 
+/** Returns a new mutable array containing the non-`nil` results of calling the given transformation with each element of this sequence.
+ *
+ * @param transform     A closure that accepts an element of this sequence as its parameter and returns a transformed value of the same or of a different type.
+ * @param expectedCount The number of elements the result is expected to hold, used to size it up front.
+ *
+ * @return              A new mutable array of the non-`nil` results of calling `transform` with each element of the sequence.
+ */
+- (NSMutableArray<id> *)mutableArrayByMapping:(nullable id (^)(ElementType object))transform expectedCount:(NSUInteger)expectedCount;
+
+/** Returns a new array containing the non-`nil` results of calling the given transformation with each element of this sequence, transforming the elements concurrently.
+ *
+ * The remaining elements are collected before any of them are transformed.
+ *
+ * @param transform     A closure that accepts an element of this sequence as its parameter and returns a transformed value of the same or of a different type. It may be called concurrently from multiple threads.
+ * @param executor      The executor that schedules the transformations.
+ *
+ * @return              A new array of the non-`nil` results of calling `transform` with each element of the sequence, in the order of the sequence.
+ */
+- (NSArray<id> *)arrayByMapping:(nullable id (^)(ElementType object))transform executor:(CBHMapReduceExecutor *)executor;
+
 
 /** Returns a new set containing the non-`nil` results of calling the given transformation with each element of this sequence.
  *
@@ -50,6 +82,15 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (NSSet<id> *)setByMapping:(nullable id (^)(ElementType object))transform;
 
+/** Returns a new set containing the non-`nil` results of calling the given transformation with each element of this sequence.
+ *
+ * @param transform     A closure that accepts an element of this sequence as its parameter and returns a transformed value of the same or of a different type.
+ * @param expectedCount The number of elements the result is expected to hold, used to size it up front.
+ *
+ * @return              A new set of the non-`nil` results of calling `transform` with each element of the sequence.
+ */
+- (NSSet<id> *)setByMapping:(nullable id (^)(ElementType object))transform expectedCount:(NSUInteger)expectedCount;
+
 /** Returns a new mutable set containing the non-`nil` results of calling the given transformation with each element of this sequence.
  *
  * @param transform     A closure that accepts an element of this sequence as its parameter and returns a transformed value of the same or of a different type.
@@ -58,6 +99,15 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (NSMutableSet<id> *)mutableSetByMapping:(nullable id (^)(ElementType object))transform;
 
+/** Returns a new mutable set containing the non-`nil` results of calling the given transformation with each element of this sequence.
+ *
+ * @param transform     A closure that accepts an element of this sequence as its parameter and returns a transformed value of the same or of a different type.
+ * @param expectedCount The number of elements the result is expected to hold, used to size it up front.
+ *
+ * @return              A new mutable set of the non-`nil` results of calling `transform` with each element of the sequence.
+ */
+- (NSMutableSet<id> *)mutableSetByMapping:(nullable id (^)(ElementType object))transform expectedCount:(NSUInteger)expectedCount;
+
 
 /** Returns a new ordered set containing the non-`nil` results of calling the given transformation with each element of this sequence.
  *
@@ -67,6 +117,15 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (NSOrderedSet<id> *)orderedSetByMapping:(nullable id (^)(ElementType object))transform;
 
+/** Returns a new ordered set containing the non-`nil` results of calling the given transformation with each element of this sequence.
+ *
+ * @param transform     A closure that accepts an element of this sequence as its parameter and returns a transformed value of the same or of a different type.
+ * @param expectedCount The number of elements the result is expected to hold, used to size it up front.
+ *
+ * @return              A new ordered set of the non-`nil` results of calling `transform` with each element of the sequence.
+ */
+- (NSOrderedSet<id> *)orderedSetByMapping:(nullable id (^)(ElementType object))transform expectedCount:(NSUInteger)expectedCount;
+
 /** Returns a new mutable ordered set containing the non-`nil` results of calling the given transformation with each element of this sequence.
  *
  * @param transform     A closure that accepts an element of this sequence as its parameter and returns a transformed value of the same or of a different type.
@@ -75,6 +134,15 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (NSMutableOrderedSet<id> *)mutableOrderedSetByMapping:(nullable id (^)(ElementType object))transform;
 
+/** Returns a new mutable ordered set containing the non-`nil` results of calling the given transformation with each element of this sequence.
+ *
+ * @param transform     A closure that accepts an element of this sequence as its parameter and returns a transformed value of the same or of a different type.
+ * @param expectedCount The number of elements the result is expected to hold, used to size it up front.
+ *
+ * @return              A new mutable ordered set of the non-`nil` results of calling `transform` with each element of the sequence.
+ */
+- (NSMutableOrderedSet<id> *)mutableOrderedSetByMapping:(nullable id (^)(ElementType object))transform expectedCount:(NSUInteger)expectedCount;
+
 
 #pragma mark - Filtering
 
@@ -86,6 +154,15 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (NSArray<ElementType> *)arrayByFiltering:(BOOL (^)(ElementType object))predicate;
 
+/** Returns a new array containing the elements of the sequence that satisfy the given predicate.
+ *
+ * @param predicate     A closure that takes an element as its argument and returns a Boolean value indicating whether the element should be included in the returned array.
+ * @param expectedCount The number of elements the result is expected to hold, used to size it up front.
+ *
+ * @return              A new array of the elements that `predicate` allows.
+ */
+- (NSArray<ElementType> *)arrayByFiltering:(BOOL (^)(ElementType object))predicate expectedCount:(NSUInteger)expectedCount;
+
 /** Returns a new mutable array containing the elements of the array that satisfy the given predicate.
  *
  * @param predicate     A closure that takes an element as its argument and returns a Boolean value indicating whether the element should be included in the returned mutable array.
@@ -94,6 +171,26 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (NSMutableArray<ElementType> *)mutableArrayByFiltering:(BOOL (^)(ElementType object))predicate;
 
+/** Returns a new mutable array containing the elements of the array that satisfy the given predicate.
+ *
+ * @param predicate     A closure that takes an element as its argument and returns a Boolean value indicating whether the element should be included in the returned mutable array.
+ * @param expectedCount The number of elements the result is expected to hold, used to size it up front.
+ *
+ * @return              A new mutable array of the elements that `predicate` allows.
+ */
+- (NSMutableArray<ElementType> *)mutableArrayByFiltering:(BOOL (^)(ElementType object))predicate expectedCount:(NSUInteger)expectedCount;
+
+/** Returns a new array containing the elements of the sequence that satisfy the given predicate, evaluating the predicate concurrently.
+ *
+ * The remaining elements are collected before any of them are evaluated.
+ *
+ * @param predicate     A closure that takes an element as its argument and returns a Boolean value indicating whether the element should be included in the returned array. It may be called concurrently from multiple threads.
+ * @param executor      The executor that schedules the evaluations.
+ *
+ * @return              A new array of the elements that `predicate` allows, in the order of the sequence.
+ */
+- (NSArray<ElementType> *)arrayByFiltering:(BOOL (^)(ElementType object))predicate executor:(CBHMapReduceExecutor *)executor;
+
 
 /** Returns a new set containing the elements of the sequence that satisfy the given predicate.
  *
@@ -103,6 +200,15 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (NSSet<ElementType> *)setByFiltering:(BOOL (^)(ElementType object))predicate;
 
+/** Returns a new set containing the elements of the sequence that satisfy the given predicate.
+ *
+ * @param predicate     A closure that takes an element as its argument and returns a Boolean value indicating whether the element should be included in the returned set.
+ * @param expectedCount The number of elements the result is expected to hold, used to size it up front.
+ *
+ * @return              A new set of the elements that `predicate` allows.
+ */
+- (NSSet<ElementType> *)setByFiltering:(BOOL (^)(ElementType object))predicate expectedCount:(NSUInteger)expectedCount;
+
 /** Returns a new mutable set containing the elements of the sequence that satisfy the given predicate.
  *
  * @param predicate     A closure that takes an element as its argument and returns a Boolean value indicating whether the element should be included in the returned mutable set.
@@ -111,6 +217,15 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (NSMutableSet<ElementType> *)mutableSetByFiltering:(BOOL (^)(ElementType object))predicate;
 
+/** Returns a new mutable set containing the elements of the sequence that satisfy the given predicate.
+ *
+ * @param predicate     A closure that takes an element as its argument and returns a Boolean value indicating whether the element should be included in the returned mutable set.
+ * @param expectedCount The number of elements the result is expected to hold, used to size it up front.
+ *
+ * @return              A new mutable set of the elements that `predicate` allows.
+ */
+- (NSMutableSet<ElementType> *)mutableSetByFiltering:(BOOL (^)(ElementType object))predicate expectedCount:(NSUInteger)expectedCount;
+
 
 /** Returns a new ordered set containing the elements of the sequence that satisfy the given predicate.
  *
@@ -120,6 +235,15 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (NSOrderedSet<ElementType> *)orderedSetByFiltering:(BOOL (^)(ElementType object))predicate;
 
+/** Returns a new ordered set containing the elements of the sequence that satisfy the given predicate.
+ *
+ * @param predicate     A closure that takes an element as its argument and returns a Boolean value indicating whether the element should be included in the returned ordered set.
+ * @param expectedCount The number of elements the result is expected to hold, used to size it up front.
+ *
+ * @return              A new ordered set of the elements that `predicate` allows.
+ */
+- (NSOrderedSet<ElementType> *)orderedSetByFiltering:(BOOL (^)(ElementType object))predicate expectedCount:(NSUInteger)expectedCount;
+
 /** Returns a new mutable ordered set containing the elements of the sequence that satisfy the given predicate.
  *
  * @param predicate     A closure that takes an element as its argument and returns a Boolean value indicating whether the element should be included in the returned mutable ordered set.
@@ -128,6 +252,15 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (NSMutableOrderedSet<ElementType> *)mutableOrderedSetByFiltering:(BOOL (^)(ElementType object))predicate;
 
+/** Returns a new mutable ordered set containing the elements of the sequence that satisfy the given predicate.
+ *
+ * @param predicate     A closure that takes an element as its argument and returns a Boolean value indicating whether the element should be included in the returned mutable ordered set.
+ * @param expectedCount The number of elements the result is expected to hold, used to size it up front.
+ *
+ * @return              A new mutable ordered set of the elements that `predicate` allows.
+ */
+- (NSMutableOrderedSet<ElementType> *)mutableOrderedSetByFiltering:(BOOL (^)(ElementType object))predicate expectedCount:(NSUInteger)expectedCount;
+
 
 #pragma mark - Reducing
 
@@ -140,6 +273,285 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (nullable id)initial:(nullable id)initial reduce:(nullable id (^)(id __nullable accumulated, ElementType object))reduce;
 
+/** Returns the result of combining the elements of the sequence using the given associative closure, computed concurrently.
+ *
+ * The remaining elements are collected first. Each chunk of them is reduced on its own and the results of the chunks are then combined in order, starting from `initial`.
+ *
+ * @param initial   The value to use as the initial accumulating value.
+ * @param combine   An associative closure that returns the combination of two accumulated values, where elements are themselves accumulated values. It may be called concurrently from multiple threads.
+ * @param executor  The executor to run the chunks on.
+ *
+ * @return          The final accumulated value. If the sequence has no elements, the result is `initial`.
+ */
+- (nullable id)initial:(nullable id)initial associativeReduce:(nullable id (^)(id __nullable lhs, id rhs))combine executor:(CBHMapReduceExecutor *)executor;
+
+/** Returns the results of combining the elements of the sequence that share a key using the given closure.
+ *
+ * @param key       A closure that returns the key of an element, or `nil` to skip it.
+ * @param initial   The value to use as the initial accumulating value of each key.
+ * @param reduce    A closure that returns a new accumulating value resultant from the combination of whats already been accumulated for a key with an element of the sequence.
+ *
+ * @return          A new dictionary of the final accumulated value of each key.
+ */
+- (NSDictionary<id, id> *)dictionaryByReducingWithKey:(nullable id<NSCopying> (^)(ElementType object))key initial:(nullable id)initial reduce:(id (^)(id __nullable accumulated, ElementType object))reduce;
+
+/** Returns the results of combining the elements of the sequence that share a key using the given closure, spilling to disk when the accumulated values outgrow a memory budget.
+ *
+ * Values are accumulated in memory until their estimated size exceeds `budget`. Keys are hash partitioned, and the accumulated values
+ * of the largest partition are then written to a temporary file, followed by every later element of its keys, until the rest fit.
+ * The keys of partitions that were not spilled keep being reduced in memory, and each spilled partition is reduced in turn at the
+ * end. Elements are reduced in the order they are enumerated, so the result is the same as that of the in-memory method.
+ *
+ * Keys, elements and accumulated values must be property-list objects, `NSNull` or conform to `NSCoding` to be spilled. Spilled
+ * arrays and dictionaries are read back mutable. The size of an accumulated value is estimated from the count or length of its
+ * contents, including mutations made in place, but not from the objects it references, so the budget should leave room for those.
+ *
+ * @param key       A closure that returns the key of an element, or `nil` to skip it.
+ * @param initial   The value to use as the initial accumulating value of each key.
+ * @param reduce    A closure that returns a new accumulating value resultant from the combination of whats already been accumulated for a key with an element of the sequence.
+ * @param budget    The estimated number of bytes the accumulated values may occupy before they are spilled.
+ * @param executor  The executor to reduce partitions on concurrently, in which case `reduce` must be safe to call from multiple threads, or `nil` to reduce them serially on the calling thread.
+ * @param error     On failure, the reason the elements could not be spilled.
+ *
+ * @return          A new dictionary of the final accumulated value of each key, or `nil` on failure.
+ */
+- (nullable NSDictionary<id, id> *)dictionaryByReducingWithKey:(nullable id<NSCopying> (^)(ElementType object))key initial:(nullable id)initial reduce:(id (^)(id __nullable accumulated, ElementType object))reduce memoryBudget:(NSUInteger)budget executor:(nullable CBHMapReduceExecutor *)executor error:(NSError **)error;
+
+
+#pragma mark - Scanning
+
+/** Returns the running results of combining the elements of the sequence using the given closure.
+ *
+ * @param initial   The value to use as the initial accumulating value.
+ * @param scan      A closure that returns a new accumulating value resultant from the combination of whats already been accumulated with an element of the sequence.
+ *
+ * @return          A new array whose element at each index is the value accumulated up to and including the element at that index, or `NSNull` where it is `nil`.
+ */
+- (NSArray<id> *)initial:(nullable id)initial scan:(nullable id (^)(id __nullable accumulated, ElementType object))scan;
+
+/** Returns the running results of combining the elements of the sequence using the given closure, excluding each element from its own result.
+ *
+ * @param initial   The value to use as the initial accumulating value.
+ * @param scan      A closure that returns a new accumulating value resultant from the combination of whats already been accumulated with an element of the sequence.
+ *
+ * @return          A new array whose element at each index is the value accumulated before the element at that index, beginning with `initial`, or `NSNull` where it is `nil`.
+ */
+- (NSArray<id> *)initial:(nullable id)initial exclusiveScan:(nullable id (^)(id __nullable accumulated, ElementType object))scan;
+
+/** Returns the running results of combining the elements of the sequence into an unboxed double using the given closure.
+ *
+ * @param initial   The value to use as the initial accumulating value.
+ * @param scan      A closure that returns a new accumulating value resultant from the combination of whats already been accumulated with an element of the sequence.
+ *
+ * @return          A new data object of packed doubles whose value at each index is the value accumulated up to and including the element at that index.
+ */
+- (NSData *)initialDouble:(double)initial scan:(double (^)(double accumulated, ElementType object))scan;
+
+/** Returns the running results of combining the elements of the sequence into an unboxed double using the given closure, excluding each element from its own result.
+ *
+ * @param initial   The value to use as the initial accumulating value.
+ * @param scan      A closure that returns a new accumulating value resultant from the combination of whats already been accumulated with an element of the sequence.
+ *
+ * @return          A new data object of packed doubles whose value at each index is the value accumulated before the element at that index, beginning with `initial`.
+ */
+- (NSData *)initialDouble:(double)initial exclusiveScan:(double (^)(double accumulated, ElementType object))scan;
+
+
+#pragma mark - Windowing
+
+/** Returns an enumerator of the consecutive chunks of the sequence that reads one chunk at a time.
+ *
+ * @param size      The number of elements in each chunk. The final chunk may have fewer.
+ *
+ * @return          A new enumerator of arrays.
+ */
+- (NSEnumerator<NSArray<ElementType> *> *)chunksOfSize:(NSUInteger)size;
+
+/** Returns an enumerator of the full windows of the sequence that holds one window at a time.
+ *
+ * @param size      The number of elements in each window.
+ * @param step      The number of elements between the starts of consecutive windows.
+ *
+ * @return          A new enumerator of arrays.
+ */
+- (NSEnumerator<NSArray<ElementType> *> *)windowsOfSize:(NSUInteger)size step:(NSUInteger)step;
+
+/** Returns the result of combining the elements of each full window of the sequence, sliding the window one element at a time.
+ *
+ * Each slide adds the element entering the window and removes the element leaving it, so it costs O(1) however large the window.
+ *
+ * @param size      The number of elements in each window.
+ * @param initial   The value to use as the initial accumulating value.
+ * @param add       A closure that returns the accumulating value with an element added.
+ * @param remove    A closure that returns the accumulating value with an element, previously added, removed.
+ *
+ * @return          A new array of the accumulated value of each window, or `NSNull` where it is `nil`.
+ */
+- (NSArray<id> *)windowedReduceOfSize:(NSUInteger)size initial:(nullable id)initial add:(nullable id (^)(id __nullable accumulated, ElementType object))add remove:(nullable id (^)(id __nullable accumulated, ElementType object))remove;
+
+/** Returns the result of combining the elements of each full window of the sequence into an unboxed double, sliding the window one element at a time.
+ *
+ * @param size      The number of elements in each window.
+ * @param initial   The value to use as the initial accumulating value.
+ * @param add       A closure that returns the accumulating value with an element added.
+ * @param remove    A closure that returns the accumulating value with an element, previously added, removed.
+ *
+ * @return          A new data object of the packed double accumulated for each window.
+ */
+- (NSData *)windowedReduceOfSize:(NSUInteger)size initialDouble:(double)initial add:(double (^)(double accumulated, ElementType object))add remove:(double (^)(double accumulated, ElementType object))remove;
+
+
+#pragma mark - Joining
+
+/** Returns a new array containing the non-`nil` results of combining each pair of elements from the receiver and another collection whose keys are equal.
+ *
+ * A hash table is built over `other` and the receiver is streamed through it. The results follow the order of the receiver.
+ *
+ * @param other         The collection to join the receiver with.
+ * @param leftKey       A closure that returns the key of an element of the receiver. Elements with a `nil` key are never matched.
+ * @param rightKey      A closure that returns the key of an element of `other`. Elements with a `nil` key are never matched.
+ * @param combine       A closure that accepts a matching pair of elements and returns a combined value.
+ *
+ * @return              A new array of the non-`nil` results of calling `combine` with each matching pair.
+ */
+- (NSArray<id> *)joinWith:(id<NSFastEnumeration>)other leftKey:(nullable id (^)(ElementType object))leftKey rightKey:(nullable id (^)(id object))rightKey combine:(nullable id (^)(ElementType left, id right))combine;
+
+/** Returns a new array containing the non-`nil` results of combining each pair of elements from the receiver and another collection whose keys are equal.
+ *
+ * A hash table is built over `other` and the receiver is streamed through it. The results follow the order of the receiver.
+ *
+ * @param other         The collection to join the receiver with.
+ * @param leftKey       A closure that returns the key of an element of the receiver. Elements with a `nil` key are never matched.
+ * @param rightKey      A closure that returns the key of an element of `other`. Elements with a `nil` key are never matched.
+ * @param options       The options to perform the join with.
+ * @param combine       A closure that accepts a matching pair of elements and returns a combined value.
+ *
+ * @return              A new array of the non-`nil` results of calling `combine` with each matching pair.
+ */
+- (NSArray<id> *)joinWith:(id<NSFastEnumeration>)other leftKey:(nullable id (^)(ElementType object))leftKey rightKey:(nullable id (^)(id object))rightKey options:(CBHJoinOptions)options combine:(nullable id (^)(ElementType left, id right))combine;
+
+/** Returns a new array containing the non-`nil` results of combining each pair of elements from the receiver and another collection whose keys are equal.
+ *
+ * A hash table is built over `other` and the receiver is streamed through it. The results follow the order of the receiver.
+ *
+ * @param other         The collection to join the receiver with.
+ * @param leftKey       A closure that returns the key of an element of the receiver. Elements with a `nil` key are never matched.
+ * @param rightKey      A closure that returns the key of an element of `other`. Elements with a `nil` key are never matched.
+ * @param executor      The executor that probes partitions of the streamed collection concurrently. The key and combine closures may be called concurrently from multiple threads.
+ * @param combine       A closure that accepts a matching pair of elements and returns a combined value.
+ *
+ * @return              A new array of the non-`nil` results of calling `combine` with each matching pair.
+ */
+- (NSArray<id> *)joinWith:(id<NSFastEnumeration>)other leftKey:(nullable id (^)(ElementType object))leftKey rightKey:(nullable id (^)(id object))rightKey executor:(CBHMapReduceExecutor *)executor combine:(nullable id (^)(ElementType left, id right))combine;
+
+
+/** Returns a new array containing the non-`nil` results of combining each element of the receiver with the elements of another collection whose keys are equal.
+ *
+ * Elements of the receiver without a match are combined with `nil`.
+ *
+ * @param other         The collection to join the receiver with.
+ * @param leftKey       A closure that returns the key of an element of the receiver. Elements with a `nil` key are never matched.
+ * @param rightKey      A closure that returns the key of an element of `other`. Elements with a `nil` key are never matched.
+ * @param combine       A closure that accepts an element of the receiver and its match, or `nil`, and returns a combined value.
+ *
+ * @return              A new array of the non-`nil` results of calling `combine` with each element of the receiver and its matches.
+ */
+- (NSArray<id> *)leftOuterJoinWith:(id<NSFastEnumeration>)other leftKey:(nullable id (^)(ElementType object))leftKey rightKey:(nullable id (^)(id object))rightKey combine:(nullable id (^)(ElementType left, id __nullable right))combine;
+
+/** Returns a new array containing the non-`nil` results of combining each element of the receiver with the elements of another collection whose keys are equal.
+ *
+ * Elements of the receiver without a match are combined with `nil`.
+ *
+ * @param other         The collection to join the receiver with.
+ * @param leftKey       A closure that returns the key of an element of the receiver. Elements with a `nil` key are never matched.
+ * @param rightKey      A closure that returns the key of an element of `other`. Elements with a `nil` key are never matched.
+ * @param options       The options to perform the join with.
+ * @param combine       A closure that accepts an element of the receiver and its match, or `nil`, and returns a combined value.
+ *
+ * @return              A new array of the non-`nil` results of calling `combine` with each element of the receiver and its matches.
+ */
+- (NSArray<id> *)leftOuterJoinWith:(id<NSFastEnumeration>)other leftKey:(nullable id (^)(ElementType object))leftKey rightKey:(nullable id (^)(id object))rightKey options:(CBHJoinOptions)options combine:(nullable id (^)(ElementType left, id __nullable right))combine;
+
+/** Returns a new array containing the non-`nil` results of combining each element of the receiver with the elements of another collection whose keys are equal.
+ *
+ * Elements of the receiver without a match are combined with `nil`.
+ *
+ * @param other         The collection to join the receiver with.
+ * @param leftKey       A closure that returns the key of an element of the receiver. Elements with a `nil` key are never matched.
+ * @param rightKey      A closure that returns the key of an element of `other`. Elements with a `nil` key are never matched.
+ * @param executor      The executor that probes partitions of the streamed collection concurrently. The key and combine closures may be called concurrently from multiple threads.
+ * @param combine       A closure that accepts an element of the receiver and its match, or `nil`, and returns a combined value.
+ *
+ * @return              A new array of the non-`nil` results of calling `combine` with each element of the receiver and its matches.
+ */
+- (NSArray<id> *)leftOuterJoinWith:(id<NSFastEnumeration>)other leftKey:(nullable id (^)(ElementType object))leftKey rightKey:(nullable id (^)(id object))rightKey executor:(CBHMapReduceExecutor *)executor combine:(nullable id (^)(ElementType left, id __nullable right))combine;
+
+
+/** Returns a new array containing the elements of the receiver that have at least one element in another collection with an equal key.
+ *
+ * @param other         The collection to join the receiver with.
+ * @param leftKey       A closure that returns the key of an element of the receiver. Elements with a `nil` key are never matched.
+ * @param rightKey      A closure that returns the key of an element of `other`. Elements with a `nil` key are never matched.
+ *
+ * @return              A new array of the elements of the receiver that have a match.
+ */
+- (NSArray<ElementType> *)semiJoinWith:(id<NSFastEnumeration>)other leftKey:(nullable id (^)(ElementType object))leftKey rightKey:(nullable id (^)(id object))rightKey;
+
+/** Returns a new array containing the elements of the receiver that have at least one element in another collection with an equal key.
+ *
+ * @param other         The collection to join the receiver with.
+ * @param leftKey       A closure that returns the key of an element of the receiver. Elements with a `nil` key are never matched.
+ * @param rightKey      A closure that returns the key of an element of `other`. Elements with a `nil` key are never matched.
+ * @param options       The options to perform the join with.
+ *
+ * @return              A new array of the elements of the receiver that have a match.
+ */
+- (NSArray<ElementType> *)semiJoinWith:(id<NSFastEnumeration>)other leftKey:(nullable id (^)(ElementType object))leftKey rightKey:(nullable id (^)(id object))rightKey options:(CBHJoinOptions)options;
+
+/** Returns a new array containing the elements of the receiver that have at least one element in another collection with an equal key.
+ *
+ * @param other         The collection to join the receiver with.
+ * @param leftKey       A closure that returns the key of an element of the receiver. Elements with a `nil` key are never matched.
+ * @param rightKey      A closure that returns the key of an element of `other`. Elements with a `nil` key are never matched.
+ * @param executor      The executor that probes partitions of the streamed collection concurrently. The key closures may be called concurrently from multiple threads.
+ *
+ * @return              A new array of the elements of the receiver that have a match.
+ */
+- (NSArray<ElementType> *)semiJoinWith:(id<NSFastEnumeration>)other leftKey:(nullable id (^)(ElementType object))leftKey rightKey:(nullable id (^)(id object))rightKey executor:(CBHMapReduceExecutor *)executor;
+
+
+/** Returns a new array containing the elements of the receiver that have no element in another collection with an equal key.
+ *
+ * @param other         The collection to join the receiver with.
+ * @param leftKey       A closure that returns the key of an element of the receiver. Elements with a `nil` key are never matched.
+ * @param rightKey      A closure that returns the key of an element of `other`. Elements with a `nil` key are never matched.
+ *
+ * @return              A new array of the elements of the receiver that have no match.
+ */
+- (NSArray<ElementType> *)antiJoinWith:(id<NSFastEnumeration>)other leftKey:(nullable id (^)(ElementType object))leftKey rightKey:(nullable id (^)(id object))rightKey;
+
+/** Returns a new array containing the elements of the receiver that have no element in another collection with an equal key.
+ *
+ * @param other         The collection to join the receiver with.
+ * @param leftKey       A closure that returns the key of an element of the receiver. Elements with a `nil` key are never matched.
+ * @param rightKey      A closure that returns the key of an element of `other`. Elements with a `nil` key are never matched.
+ * @param options       The options to perform the join with.
+ *
+ * @return              A new array of the elements of the receiver that have no match.
+ */
+- (NSArray<ElementType> *)antiJoinWith:(id<NSFastEnumeration>)other leftKey:(nullable id (^)(ElementType object))leftKey rightKey:(nullable id (^)(id object))rightKey options:(CBHJoinOptions)options;
+
+/** Returns a new array containing the elements of the receiver that have no element in another collection with an equal key.
+ *
+ * @param other         The collection to join the receiver with.
+ * @param leftKey       A closure that returns the key of an element of the receiver. Elements with a `nil` key are never matched.
+ * @param rightKey      A closure that returns the key of an element of `other`. Elements with a `nil` key are never matched.
+ * @param executor      The executor that probes partitions of the streamed collection concurrently. The key closures may be called concurrently from multiple threads.
+ *
+ * @return              A new array of the elements of the receiver that have no match.
+ */
+- (NSArray<ElementType> *)antiJoinWith:(id<NSFastEnumeration>)other leftKey:(nullable id (^)(ElementType object))leftKey rightKey:(nullable id (^)(id object))rightKey executor:(CBHMapReduceExecutor *)executor;
+
 @end
 
 NS_ASSUME_NONNULL_END
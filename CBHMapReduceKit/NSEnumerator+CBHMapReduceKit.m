@@ -18,6 +18,21 @@
 
 #import "NSEnumerator+CBHMapReduceKit.h"
 
+#import "NSArray+CBHMapReduceKit.h"
+#import "_CBHBatchEnumeration.h"
+#import "_CBHFilter.h"
+#import "_CBHMapReduceInstrumentation.h"
+#import "_CBHMapReduceJoin.h"
+#import "_CBHSpill.h"
+#import "_CBHWindows.h"
+
+
+/// The number of partitions state is hashed into once it is spilled.
+#define CBHSpillPartitionCount 64
+
+/// An estimate of the memory a dictionary uses per entry in addition to its key and value.
+static const NSUInteger CBHSpillEntryOverhead = 4 * sizeof(void *);
+
 
 @implementation NSEnumerator (CBHMapReduceKit)
 
@@ -25,56 +40,123 @@
 
 - (NSArray *)arrayByMapping:(id (^)(id object))transform
 {
-	return [self mutableArrayByMapping:transform];
+	CBH_INSTRUMENT(@"NSEnumerator", transform, [self arrayByMapping:transform]);
+
+	return [self mutableArrayByMapping:transform expectedCount:0];
+}
+
+- (NSArray *)arrayByMapping:(id (^)(id object))transform expectedCount:(NSUInteger)expectedCount
+{
+	CBH_INSTRUMENT(@"NSEnumerator", transform, [self arrayByMapping:transform expectedCount:expectedCount]);
+
+	return [self mutableArrayByMapping:transform expectedCount:expectedCount];
 }
 
 - (NSMutableArray *)mutableArrayByMapping:(id (^)(id object))transform
 {
-	NSMutableArray *result = [NSMutableArray array];
+	CBH_INSTRUMENT(@"NSEnumerator", transform, [self mutableArrayByMapping:transform]);
 
-	for (id object in self)
-	{
-		id mapping = transform(object);
-		if ( mapping ) { [result addObject:mapping]; }
-	}
+	return [self mutableArrayByMapping:transform expectedCount:0];
+}
+
+- (NSMutableArray *)mutableArrayByMapping:(id (^)(id object))transform expectedCount:(NSUInteger)expectedCount
+{
+	CBH_INSTRUMENT(@"NSEnumerator", transform, [self mutableArrayByMapping:transform expectedCount:expectedCount]);
+
+	NSMutableArray *result = [[NSMutableArray alloc] initWithCapacity:expectedCount];
+
+	CBHEnumerateInBatches(self, ^(id __unsafe_unretained const *objects, NSUInteger count) {
+		for (NSUInteger index = 0; index < count; ++index)
+		{
+			id mapping = transform(objects[index]);
+			if ( mapping ) { [result addObject:mapping]; }
+		}
+	});
 
 	return result;
 }
 
+- (NSArray *)arrayByMapping:(id (^)(id object))transform executor:(CBHMapReduceExecutor *)executor
+{
+	CBH_INSTRUMENT(@"NSEnumerator", transform, [self arrayByMapping:transform executor:executor]);
+
+	return [[self allObjects] arrayByMapping:transform executor:executor];
+}
+
 
 - (NSSet *)setByMapping:(id (^)(id object))transform
 {
-	return [self mutableSetByMapping:transform];
+	CBH_INSTRUMENT(@"NSEnumerator", transform, [self setByMapping:transform]);
+
+	return [self mutableSetByMapping:transform expectedCount:0];
+}
+
+- (NSSet *)setByMapping:(id (^)(id object))transform expectedCount:(NSUInteger)expectedCount
+{
+	CBH_INSTRUMENT(@"NSEnumerator", transform, [self setByMapping:transform expectedCount:expectedCount]);
+
+	return [self mutableSetByMapping:transform expectedCount:expectedCount];
 }
 
 - (NSMutableSet *)mutableSetByMapping:(id (^)(id object))transform
 {
-	NSMutableSet *resultSet = [NSMutableSet set];
+	CBH_INSTRUMENT(@"NSEnumerator", transform, [self mutableSetByMapping:transform]);
 
-	for (id object in self)
-	{
-		id mapping = transform(object);
-		if ( mapping ) { [resultSet addObject:mapping]; }
-	}
+	return [self mutableSetByMapping:transform expectedCount:0];
+}
+
+- (NSMutableSet *)mutableSetByMapping:(id (^)(id object))transform expectedCount:(NSUInteger)expectedCount
+{
+	CBH_INSTRUMENT(@"NSEnumerator", transform, [self mutableSetByMapping:transform expectedCount:expectedCount]);
+
+	NSMutableSet *result = [[NSMutableSet alloc] initWithCapacity:expectedCount];
 
-	return resultSet;
+	CBHEnumerateInBatches(self, ^(id __unsafe_unretained const *objects, NSUInteger count) {
+		for (NSUInteger index = 0; index < count; ++index)
+		{
+			id mapping = transform(objects[index]);
+			if ( mapping ) { [result addObject:mapping]; }
+		}
+	});
+
+	return result;
 }
 
 
 - (NSOrderedSet *)orderedSetByMapping:(id (^)(id object))transform
 {
-	return [self mutableOrderedSetByMapping:transform];
+	CBH_INSTRUMENT(@"NSEnumerator", transform, [self orderedSetByMapping:transform]);
+
+	return [self mutableOrderedSetByMapping:transform expectedCount:0];
+}
+
+- (NSOrderedSet *)orderedSetByMapping:(id (^)(id object))transform expectedCount:(NSUInteger)expectedCount
+{
+	CBH_INSTRUMENT(@"NSEnumerator", transform, [self orderedSetByMapping:transform expectedCount:expectedCount]);
+
+	return [self mutableOrderedSetByMapping:transform expectedCount:expectedCount];
 }
 
 - (NSMutableOrderedSet *)mutableOrderedSetByMapping:(id (^)(id object))transform
 {
-	NSMutableOrderedSet *result = [NSMutableOrderedSet orderedSet];
+	CBH_INSTRUMENT(@"NSEnumerator", transform, [self mutableOrderedSetByMapping:transform]);
 
-	for (id object in self)
-	{
-		id mapping = transform(object);
-		if ( mapping ) { [result addObject:mapping]; }
-	}
+	return [self mutableOrderedSetByMapping:transform expectedCount:0];
+}
+
+- (NSMutableOrderedSet *)mutableOrderedSetByMapping:(id (^)(id object))transform expectedCount:(NSUInteger)expectedCount
+{
+	CBH_INSTRUMENT(@"NSEnumerator", transform, [self mutableOrderedSetByMapping:transform expectedCount:expectedCount]);
+
+	NSMutableOrderedSet *result = [[NSMutableOrderedSet alloc] initWithCapacity:expectedCount];
+
+	CBHEnumerateInBatches(self, ^(id __unsafe_unretained const *objects, NSUInteger count) {
+		for (NSUInteger index = 0; index < count; ++index)
+		{
+			id mapping = transform(objects[index]);
+			if ( mapping ) { [result addObject:mapping]; }
+		}
+	});
 
 	return result;
 }
@@ -84,51 +166,118 @@
 
 - (NSArray *)arrayByFiltering:(BOOL (^)(id object))predicate
 {
-	return [self mutableArrayByFiltering:predicate];
+	CBH_INSTRUMENT(@"NSEnumerator", predicate, [self arrayByFiltering:predicate]);
+
+	return [self mutableArrayByFiltering:predicate expectedCount:0];
+}
+
+- (NSArray *)arrayByFiltering:(BOOL (^)(id object))predicate expectedCount:(NSUInteger)expectedCount
+{
+	CBH_INSTRUMENT(@"NSEnumerator", predicate, [self arrayByFiltering:predicate expectedCount:expectedCount]);
+
+	return [self mutableArrayByFiltering:predicate expectedCount:expectedCount];
 }
 
 - (NSMutableArray *)mutableArrayByFiltering:(BOOL (^)(id object))predicate
 {
-	NSMutableArray *result = [NSMutableArray array];
+	CBH_INSTRUMENT(@"NSEnumerator", predicate, [self mutableArrayByFiltering:predicate]);
 
-	for (id object in self)
-	{
-		if ( predicate(object) ) { [result addObject:object]; }
-	}
+	return [self mutableArrayByFiltering:predicate expectedCount:0];
+}
+
+- (NSMutableArray *)mutableArrayByFiltering:(BOOL (^)(id object))predicate expectedCount:(NSUInteger)expectedCount
+{
+	CBH_INSTRUMENT(@"NSEnumerator", predicate, [self mutableArrayByFiltering:predicate expectedCount:expectedCount]);
+
+	NSMutableArray *result = [[NSMutableArray alloc] initWithCapacity:expectedCount];
+
+	CBHEnumerateInBatches(self, ^(id __unsafe_unretained const *objects, NSUInteger count) {
+		for (NSUInteger index = 0; index < count; ++index)
+		{
+			if ( predicate(objects[index]) ) { [result addObject:objects[index]]; }
+		}
+	});
 
 	return result;
 }
 
+- (NSArray *)arrayByFiltering:(BOOL (^)(id object))predicate executor:(CBHMapReduceExecutor *)executor
+{
+	CBH_INSTRUMENT(@"NSEnumerator", predicate, [self arrayByFiltering:predicate executor:executor]);
+
+	return CBHFilterConcurrently([self allObjects], predicate, executor, [NSArray class]);
+}
+
 - (NSSet *)setByFiltering:(BOOL (^)(id object))predicate
 {
-	return [self mutableSetByFiltering:predicate];
+	CBH_INSTRUMENT(@"NSEnumerator", predicate, [self setByFiltering:predicate]);
+
+	return [self mutableSetByFiltering:predicate expectedCount:0];
+}
+
+- (NSSet *)setByFiltering:(BOOL (^)(id object))predicate expectedCount:(NSUInteger)expectedCount
+{
+	CBH_INSTRUMENT(@"NSEnumerator", predicate, [self setByFiltering:predicate expectedCount:expectedCount]);
+
+	return [self mutableSetByFiltering:predicate expectedCount:expectedCount];
 }
 
 - (NSMutableSet *)mutableSetByFiltering:(BOOL (^)(id object))predicate
 {
-	NSMutableSet *result = [NSMutableSet set];
+	CBH_INSTRUMENT(@"NSEnumerator", predicate, [self mutableSetByFiltering:predicate]);
 
-	for (id object in self)
-	{
-		if ( predicate(object) ) { [result addObject:object]; }
-	}
+	return [self mutableSetByFiltering:predicate expectedCount:0];
+}
+
+- (NSMutableSet *)mutableSetByFiltering:(BOOL (^)(id object))predicate expectedCount:(NSUInteger)expectedCount
+{
+	CBH_INSTRUMENT(@"NSEnumerator", predicate, [self mutableSetByFiltering:predicate expectedCount:expectedCount]);
+
+	NSMutableSet *result = [[NSMutableSet alloc] initWithCapacity:expectedCount];
+
+	CBHEnumerateInBatches(self, ^(id __unsafe_unretained const *objects, NSUInteger count) {
+		for (NSUInteger index = 0; index < count; ++index)
+		{
+			if ( predicate(objects[index]) ) { [result addObject:objects[index]]; }
+		}
+	});
 
 	return result;
 }
 
 - (NSOrderedSet *)orderedSetByFiltering:(BOOL (^)(id object))predicate
 {
-	return [self mutableOrderedSetByFiltering:predicate];
+	CBH_INSTRUMENT(@"NSEnumerator", predicate, [self orderedSetByFiltering:predicate]);
+
+	return [self mutableOrderedSetByFiltering:predicate expectedCount:0];
+}
+
+- (NSOrderedSet *)orderedSetByFiltering:(BOOL (^)(id object))predicate expectedCount:(NSUInteger)expectedCount
+{
+	CBH_INSTRUMENT(@"NSEnumerator", predicate, [self orderedSetByFiltering:predicate expectedCount:expectedCount]);
+
+	return [self mutableOrderedSetByFiltering:predicate expectedCount:expectedCount];
 }
 
 - (NSMutableOrderedSet *)mutableOrderedSetByFiltering:(BOOL (^)(id object))predicate
 {
-	NSMutableOrderedSet *result = [NSMutableOrderedSet orderedSet];
+	CBH_INSTRUMENT(@"NSEnumerator", predicate, [self mutableOrderedSetByFiltering:predicate]);
 
-	for (id object in self)
-	{
-		if ( predicate(object) ) { [result addObject:object]; }
-	}
+	return [self mutableOrderedSetByFiltering:predicate expectedCount:0];
+}
+
+- (NSMutableOrderedSet *)mutableOrderedSetByFiltering:(BOOL (^)(id object))predicate expectedCount:(NSUInteger)expectedCount
+{
+	CBH_INSTRUMENT(@"NSEnumerator", predicate, [self mutableOrderedSetByFiltering:predicate expectedCount:expectedCount]);
+
+	NSMutableOrderedSet *result = [[NSMutableOrderedSet alloc] initWithCapacity:expectedCount];
+
+	CBHEnumerateInBatches(self, ^(id __unsafe_unretained const *objects, NSUInteger count) {
+		for (NSUInteger index = 0; index < count; ++index)
+		{
+			if ( predicate(objects[index]) ) { [result addObject:objects[index]]; }
+		}
+	});
 
 	return result;
 }
@@ -138,14 +287,391 @@
 
 - (id)initial:(id)initial reduce:(id (^)(id accumulated, id object))reduce
 {
+	CBH_INSTRUMENT(@"NSEnumerator", reduce, [self initial:initial reduce:reduce]);
+
+	__block id accumulated = initial;
+
+	CBHEnumerateInBatches(self, ^(id __unsafe_unretained const *objects, NSUInteger count) {
+		for (NSUInteger index = 0; index < count; ++index)
+		{
+			accumulated = reduce(accumulated, objects[index]);
+		}
+	});
+
+	return accumulated;
+}
+
+- (id)initial:(id)initial associativeReduce:(id (^)(id lhs, id rhs))combine executor:(CBHMapReduceExecutor *)executor
+{
+	CBH_INSTRUMENT(@"NSEnumerator", combine, [self initial:initial associativeReduce:combine executor:executor]);
+
+	return [[self allObjects] initial:initial associativeReduce:combine executor:executor];
+}
+
+- (NSDictionary *)dictionaryByReducingWithKey:(id (^)(id object))key initial:(id)initial reduce:(id (^)(id accumulated, id object))reduce
+{
+	CBH_INSTRUMENT_PAIR(@"NSEnumerator", key, reduce, [self dictionaryByReducingWithKey:key initial:initial reduce:reduce]);
+
+	NSMutableDictionary *reductions = [[NSMutableDictionary alloc] init];
+
+	CBHEnumerateInBatches(self, ^(id __unsafe_unretained const *objects, NSUInteger count) {
+		for (NSUInteger index = 0; index < count; ++index)
+		{
+			id objectKey = key(objects[index]);
+			if ( !objectKey ) { continue; }
+
+			id accumulated = [reductions objectForKey:objectKey] ?: initial;
+			[reductions setObject:reduce(accumulated, objects[index]) forKey:objectKey];
+		}
+	});
+
+	return reductions;
+}
+
+- (NSDictionary *)dictionaryByReducingWithKey:(id (^)(id object))key initial:(id)initial reduce:(id (^)(id accumulated, id object))reduce memoryBudget:(NSUInteger)budget executor:(CBHMapReduceExecutor *)executor error:(NSError **)error
+{
+	CBH_INSTRUMENT_PAIR(@"NSEnumerator", key, reduce, [self dictionaryByReducingWithKey:key initial:initial reduce:reduce memoryBudget:budget executor:executor error:error]);
+
+	NSMutableDictionary *reductions = [[NSMutableDictionary alloc] init];
+	NSMutableDictionary<id, NSNumber *> *charges = [[NSMutableDictionary alloc] init];
+	NSUInteger partitionEstimates[CBHSpillPartitionCount] = {0};
+	BOOL isPartitionSpilled[CBHSpillPartitionCount] = {NO};
+	NSUInteger estimate = 0;
+	CBHSpill *spill = nil;
+
+	for (id object in self)
+	{
+		id objectKey = key(object);
+		if ( !objectKey ) { continue; }
+
+		NSUInteger partition = CBHSpillPartitionOfKey(objectKey, CBHSpillPartitionCount);
+
+		/// Once a partition is spilled, its elements are appended to it so each of its keys is still reduced in order.
+		if ( isPartitionSpilled[partition] )
+		{
+			if ( ![spill writeKey:objectKey value:object seed:NO error:error] ) { return nil; }
+			continue;
+		}
+
+		id previous = [reductions objectForKey:objectKey];
+		id accumulated = reduce(previous ?: initial, object);
+		[reductions setObject:accumulated forKey:objectKey];
+
+		/// The size charged for each value is kept, since an accumulator mutated in place no longer has its earlier size.
+		NSUInteger size = CBHSpillEstimateSize(accumulated);
+		NSUInteger added = size;
+		NSUInteger removed = 0;
+
+		if ( previous ) { removed = [[charges objectForKey:objectKey] unsignedIntegerValue]; }
+		else { added += CBHSpillEstimateSize(objectKey) + CBHSpillEntryOverhead; }
+
+		[charges setObject:@(size) forKey:objectKey];
+		partitionEstimates[partition] = partitionEstimates[partition] + added - removed;
+		estimate = estimate + added - removed;
+
+		/// The largest partitions are spilled until the rest fit, and the keys of the others keep being reduced in memory.
+		while ( estimate > budget )
+		{
+			NSUInteger largest = 0;
+
+			for (NSUInteger index = 1; index < CBHSpillPartitionCount; ++index)
+			{
+				if ( partitionEstimates[index] > partitionEstimates[largest] ) { largest = index; }
+			}
+
+			if ( !spill )
+			{
+				spill = [[CBHSpill alloc] initWithPartitionCount:CBHSpillPartitionCount error:error];
+				if ( !spill ) { return nil; }
+			}
+
+			NSMutableArray *spilledKeys = [[NSMutableArray alloc] init];
+
+			for (id reductionKey in reductions)
+			{
+				if ( CBHSpillPartitionOfKey(reductionKey, CBHSpillPartitionCount) != largest ) { continue; }
+				if ( ![spill writeKey:reductionKey value:[reductions objectForKey:reductionKey] seed:YES error:error] ) { return nil; }
+
+				[spilledKeys addObject:reductionKey];
+			}
+
+			[reductions removeObjectsForKeys:spilledKeys];
+			[charges removeObjectsForKeys:spilledKeys];
+
+			estimate -= partitionEstimates[largest];
+			partitionEstimates[largest] = 0;
+			isPartitionSpilled[largest] = YES;
+		}
+	}
+
+	if ( !spill ) { return reductions; }
+	if ( ![spill finishWritingWithError:error] ) { return nil; }
+
+	__block NSError *failure = nil;
+
+	void (^reducePartition)(NSUInteger partition) = ^(NSUInteger partition) {
+		NSMutableDictionary *partitionReductions = [[NSMutableDictionary alloc] init];
+		NSError *partitionError = nil;
+
+		BOOL isReduced = [spill enumeratePartition:partition error:&partitionError usingBlock:^(id recordKey, id value, BOOL isSeed) {
+			if ( isSeed )
+			{
+				[partitionReductions setObject:value forKey:recordKey];
+				return;
+			}
+
+			id partitionAccumulated = [partitionReductions objectForKey:recordKey] ?: initial;
+			[partitionReductions setObject:reduce(partitionAccumulated, value) forKey:recordKey];
+		}];
+
+		/// Partitions hold disjoint keys, and none of those left in memory, so they merge without conflict.
+		@synchronized (reductions)
+		{
+			if ( isReduced ) { [reductions addEntriesFromDictionary:partitionReductions]; }
+			else if ( !failure ) { failure = partitionError; }
+		}
+	};
+
+	if ( executor )
+	{
+		[executor applyRangesOfCount:[spill partitionCount] block:^(NSRange range) {
+			for (NSUInteger partition = range.location; partition < NSMaxRange(range); ++partition)
+			{
+				reducePartition(partition);
+			}
+		}];
+	}
+	else
+	{
+		for (NSUInteger partition = 0; partition < [spill partitionCount]; ++partition)
+		{
+			reducePartition(partition);
+		}
+	}
+
+	if ( failure )
+	{
+		if ( error ) { *error = failure; }
+		return nil;
+	}
+
+	return reductions;
+}
+
+
+#pragma mark - Scanning
+
+- (NSArray *)initial:(id)initial scan:(id (^)(id accumulated, id object))scan
+{
+	CBH_INSTRUMENT(@"NSEnumerator", scan, [self initial:initial scan:scan]);
+
+	NSMutableArray *scans = [[NSMutableArray alloc] init];
 	id accumulated = initial;
 
 	for (id object in self)
 	{
-		accumulated = reduce(accumulated, object);
+		accumulated = scan(accumulated, object);
+		[scans addObject:accumulated ?: [NSNull null]];
 	}
 
-	return accumulated;
+	return scans;
+}
+
+- (NSArray *)initial:(id)initial exclusiveScan:(id (^)(id accumulated, id object))scan
+{
+	CBH_INSTRUMENT(@"NSEnumerator", scan, [self initial:initial exclusiveScan:scan]);
+
+	NSMutableArray *scans = [[NSMutableArray alloc] init];
+	id accumulated = initial;
+
+	for (id object in self)
+	{
+		[scans addObject:accumulated ?: [NSNull null]];
+		accumulated = scan(accumulated, object);
+	}
+
+	return scans;
+}
+
+- (NSData *)initialDouble:(double)initial scan:(double (^)(double accumulated, id object))scan
+{
+	CBH_INSTRUMENT(@"NSEnumerator", scan, [self initialDouble:initial scan:scan]);
+
+	NSMutableData *scans = [[NSMutableData alloc] init];
+	double accumulated = initial;
+
+	for (id object in self)
+	{
+		accumulated = scan(accumulated, object);
+		[scans appendBytes:&accumulated length:sizeof(double)];
+	}
+
+	return scans;
+}
+
+- (NSData *)initialDouble:(double)initial exclusiveScan:(double (^)(double accumulated, id object))scan
+{
+	CBH_INSTRUMENT(@"NSEnumerator", scan, [self initialDouble:initial exclusiveScan:scan]);
+
+	NSMutableData *scans = [[NSMutableData alloc] init];
+	double accumulated = initial;
+
+	for (id object in self)
+	{
+		[scans appendBytes:&accumulated length:sizeof(double)];
+		accumulated = scan(accumulated, object);
+	}
+
+	return scans;
+}
+
+
+#pragma mark - Windowing
+
+- (NSEnumerator *)chunksOfSize:(NSUInteger)size
+{
+	CBH_INSTRUMENT_CALL(@"NSEnumerator", [self chunksOfSize:size]);
+
+	return [[CBHWindowEnumerator alloc] initWithSource:self size:size step:size partial:YES];
+}
+
+- (NSEnumerator *)windowsOfSize:(NSUInteger)size step:(NSUInteger)step
+{
+	CBH_INSTRUMENT_CALL(@"NSEnumerator", [self windowsOfSize:size step:step]);
+
+	return [[CBHWindowEnumerator alloc] initWithSource:self size:size step:step partial:NO];
+}
+
+- (NSArray *)windowedReduceOfSize:(NSUInteger)size initial:(id)initial add:(id (^)(id accumulated, id object))add remove:(id (^)(id accumulated, id object))remove
+{
+	CBH_INSTRUMENT_PAIR(@"NSEnumerator", add, remove, [self windowedReduceOfSize:size initial:initial add:add remove:remove]);
+
+	CBHWindowValidate(size, 1);
+
+	NSMutableArray *reductions = [[NSMutableArray alloc] init];
+
+	/// A ring of the elements in the current window so each can be removed as it leaves.
+	__strong id *window = (__strong id *)calloc(size, sizeof(id));
+	NSUInteger seen = 0;
+	id accumulated = initial;
+
+	for (id object in self)
+	{
+		NSUInteger slot = seen % size;
+
+		if ( seen >= size ) { accumulated = remove(accumulated, window[slot]); }
+
+		accumulated = add(accumulated, object);
+		window[slot] = object;
+
+		if ( ++seen >= size ) { [reductions addObject:accumulated ?: [NSNull null]]; }
+	}
+
+	for (NSUInteger i = 0; i < size; ++i) { window[i] = nil; }
+	free(window);
+
+	return reductions;
+}
+
+- (NSData *)windowedReduceOfSize:(NSUInteger)size initialDouble:(double)initial add:(double (^)(double accumulated, id object))add remove:(double (^)(double accumulated, id object))remove
+{
+	CBH_INSTRUMENT_PAIR(@"NSEnumerator", add, remove, [self windowedReduceOfSize:size initialDouble:initial add:add remove:remove]);
+
+	CBHWindowValidate(size, 1);
+
+	NSMutableData *reductions = [[NSMutableData alloc] init];
+
+	/// A ring of the elements in the current window so each can be removed as it leaves.
+	__strong id *window = (__strong id *)calloc(size, sizeof(id));
+	NSUInteger seen = 0;
+	double accumulated = initial;
+
+	for (id object in self)
+	{
+		NSUInteger slot = seen % size;
+
+		if ( seen >= size ) { accumulated = remove(accumulated, window[slot]); }
+
+		accumulated = add(accumulated, object);
+		window[slot] = object;
+
+		if ( ++seen >= size ) { [reductions appendBytes:&accumulated length:sizeof(double)]; }
+	}
+
+	for (NSUInteger i = 0; i < size; ++i) { window[i] = nil; }
+	free(window);
+
+	return reductions;
+}
+
+
+#pragma mark - Joining
+
+- (NSArray *)joinWith:(id<NSFastEnumeration>)other leftKey:(id (^)(id object))leftKey rightKey:(id (^)(id object))rightKey combine:(id (^)(id left, id right))combine
+{
+	return [self joinWith:other leftKey:leftKey rightKey:rightKey options:CBHJoinOptionsNone combine:combine];
+}
+
+- (NSArray *)joinWith:(id<NSFastEnumeration>)other leftKey:(id (^)(id object))leftKey rightKey:(id (^)(id object))rightKey options:(CBHJoinOptions)options combine:(id (^)(id left, id right))combine
+{
+	CBHMapReduceExecutor *executor = ( options & CBHJoinOptionsConcurrent ) ? [CBHMapReduceExecutor defaultExecutor] : nil;
+	return CBHJoin(CBHJoinKindInner, self, NSNotFound, other, CBHJoinCount(other), leftKey, rightKey, combine, executor);
+}
+
+- (NSArray *)joinWith:(id<NSFastEnumeration>)other leftKey:(id (^)(id object))leftKey rightKey:(id (^)(id object))rightKey executor:(CBHMapReduceExecutor *)executor combine:(id (^)(id left, id right))combine
+{
+	return CBHJoin(CBHJoinKindInner, self, NSNotFound, other, CBHJoinCount(other), leftKey, rightKey, combine, executor);
+}
+
+
+- (NSArray *)leftOuterJoinWith:(id<NSFastEnumeration>)other leftKey:(id (^)(id object))leftKey rightKey:(id (^)(id object))rightKey combine:(id (^)(id left, id right))combine
+{
+	return [self leftOuterJoinWith:other leftKey:leftKey rightKey:rightKey options:CBHJoinOptionsNone combine:combine];
+}
+
+- (NSArray *)leftOuterJoinWith:(id<NSFastEnumeration>)other leftKey:(id (^)(id object))leftKey rightKey:(id (^)(id object))rightKey options:(CBHJoinOptions)options combine:(id (^)(id left, id right))combine
+{
+	CBHMapReduceExecutor *executor = ( options & CBHJoinOptionsConcurrent ) ? [CBHMapReduceExecutor defaultExecutor] : nil;
+	return CBHJoin(CBHJoinKindLeftOuter, self, NSNotFound, other, CBHJoinCount(other), leftKey, rightKey, combine, executor);
+}
+
+- (NSArray *)leftOuterJoinWith:(id<NSFastEnumeration>)other leftKey:(id (^)(id object))leftKey rightKey:(id (^)(id object))rightKey executor:(CBHMapReduceExecutor *)executor combine:(id (^)(id left, id right))combine
+{
+	return CBHJoin(CBHJoinKindLeftOuter, self, NSNotFound, other, CBHJoinCount(other), leftKey, rightKey, combine, executor);
+}
+
+
+- (NSArray *)semiJoinWith:(id<NSFastEnumeration>)other leftKey:(id (^)(id object))leftKey rightKey:(id (^)(id object))rightKey
+{
+	return [self semiJoinWith:other leftKey:leftKey rightKey:rightKey options:CBHJoinOptionsNone];
+}
+
+- (NSArray *)semiJoinWith:(id<NSFastEnumeration>)other leftKey:(id (^)(id object))leftKey rightKey:(id (^)(id object))rightKey options:(CBHJoinOptions)options
+{
+	CBHMapReduceExecutor *executor = ( options & CBHJoinOptionsConcurrent ) ? [CBHMapReduceExecutor defaultExecutor] : nil;
+	return CBHJoin(CBHJoinKindSemi, self, NSNotFound, other, CBHJoinCount(other), leftKey, rightKey, nil, executor);
+}
+
+- (NSArray *)semiJoinWith:(id<NSFastEnumeration>)other leftKey:(id (^)(id object))leftKey rightKey:(id (^)(id object))rightKey executor:(CBHMapReduceExecutor *)executor
+{
+	return CBHJoin(CBHJoinKindSemi, self, NSNotFound, other, CBHJoinCount(other), leftKey, rightKey, nil, executor);
+}
+
+
+- (NSArray *)antiJoinWith:(id<NSFastEnumeration>)other leftKey:(id (^)(id object))leftKey rightKey:(id (^)(id object))rightKey
+{
+	return [self antiJoinWith:other leftKey:leftKey rightKey:rightKey options:CBHJoinOptionsNone];
+}
+
+- (NSArray *)antiJoinWith:(id<NSFastEnumeration>)other leftKey:(id (^)(id object))leftKey rightKey:(id (^)(id object))rightKey options:(CBHJoinOptions)options
+{
+	CBHMapReduceExecutor *executor = ( options & CBHJoinOptionsConcurrent ) ? [CBHMapReduceExecutor defaultExecutor] : nil;
+	return CBHJoin(CBHJoinKindAnti, self, NSNotFound, other, CBHJoinCount(other), leftKey, rightKey, nil, executor);
+}
+
+- (NSArray *)antiJoinWith:(id<NSFastEnumeration>)other leftKey:(id (^)(id object))leftKey rightKey:(id (^)(id object))rightKey executor:(CBHMapReduceExecutor *)executor
+{
+	return CBHJoin(CBHJoinKindAnti, self, NSNotFound, other, CBHJoinCount(other), leftKey, rightKey, nil, executor);
 }
 
 @end
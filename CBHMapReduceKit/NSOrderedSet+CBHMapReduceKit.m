@@ -18,6 +18,11 @@
 
 #import "NSOrderedSet+CBHMapReduceKit.h"
 
+#import "NSArray+CBHMapReduceKit.h"
+#import "_CBHArrayView.h"
+#import "_CBHFilter.h"
+#import "_CBHMapReduceInstrumentation.h"
+
 
 @implementation NSOrderedSet (CBHMapReduceKit)
 
@@ -25,11 +30,15 @@
 
 - (NSOrderedSet *)orderedSetByMapping:(id (^)(id object))block
 {
+	CBH_INSTRUMENT(@"NSOrderedSet", block, [self orderedSetByMapping:block]);
+
 	return [self mutableOrderedSetByMapping:block];
 }
 
 - (NSMutableOrderedSet *)mutableOrderedSetByMapping:(id (^)(id object))block
 {
+	CBH_INSTRUMENT(@"NSOrderedSet", block, [self mutableOrderedSetByMapping:block]);
+
 	NSMutableOrderedSet *result = [[NSMutableOrderedSet alloc] initWithCapacity:[self count]];
 
 	for (id object in self)
@@ -44,11 +53,15 @@
 
 - (NSArray *)arrayByMapping:(id (^)(id object))block
 {
+	CBH_INSTRUMENT(@"NSOrderedSet", block, [self arrayByMapping:block]);
+
 	return [self mutableArrayByMapping:block];
 }
 
 - (NSMutableArray *)mutableArrayByMapping:(id (^)(id object))block
 {
+	CBH_INSTRUMENT(@"NSOrderedSet", block, [self mutableArrayByMapping:block]);
+
 	NSMutableArray *result = [[NSMutableArray alloc] initWithCapacity:[self count]];
 
 	for (id object in self)
@@ -60,14 +73,25 @@
 	return result;
 }
 
+- (NSArray *)arrayByMapping:(id (^)(id object))block executor:(CBHMapReduceExecutor *)executor
+{
+	CBH_INSTRUMENT(@"NSOrderedSet", block, [self arrayByMapping:block executor:executor]);
+
+	return [[self array] arrayByMapping:block executor:executor];
+}
+
 
 - (NSSet *)setByMapping:(id (^)(id object))block
 {
+	CBH_INSTRUMENT(@"NSOrderedSet", block, [self setByMapping:block]);
+
 	return [self mutableSetByMapping:block];
 }
 
 - (NSMutableSet *)mutableSetByMapping:(id (^)(id object))block
 {
+	CBH_INSTRUMENT(@"NSOrderedSet", block, [self mutableSetByMapping:block]);
+
 	NSMutableSet *resultSet = [[NSMutableSet alloc] initWithCapacity:[self count]];
 
 	for (id object in self)
@@ -84,11 +108,15 @@
 
 - (NSOrderedSet *)orderedSetByFiltering:(BOOL (^)(id object))predicate
 {
+	CBH_INSTRUMENT(@"NSOrderedSet", predicate, [self orderedSetByFiltering:predicate]);
+
 	return [self mutableOrderedSetByFiltering:predicate];
 }
 
 - (NSMutableOrderedSet *)mutableOrderedSetByFiltering:(BOOL (^)(id object))predicate
 {
+	CBH_INSTRUMENT(@"NSOrderedSet", predicate, [self mutableOrderedSetByFiltering:predicate]);
+
 	NSMutableOrderedSet *result = [[NSMutableOrderedSet alloc] initWithCapacity:[self count]];
 
 	for (id object in self)
@@ -99,11 +127,27 @@
 	return result;
 }
 
+- (NSOrderedSet *)orderedSetByFiltering:(BOOL (^)(id object))predicate executor:(CBHMapReduceExecutor *)executor
+{
+	CBH_INSTRUMENT(@"NSOrderedSet", predicate, [self orderedSetByFiltering:predicate executor:executor]);
+
+	return CBHFilterConcurrently([self array], predicate, executor, [NSOrderedSet class]);
+}
+
+- (NSMutableOrderedSet *)mutableOrderedSetByFiltering:(BOOL (^)(id object))predicate executor:(CBHMapReduceExecutor *)executor
+{
+	CBH_INSTRUMENT(@"NSOrderedSet", predicate, [self mutableOrderedSetByFiltering:predicate executor:executor]);
+
+	return CBHFilterConcurrently([self array], predicate, executor, [NSMutableOrderedSet class]);
+}
+
 
 #pragma mark - Reducing
 
 - (id)initial:(id)initial reduce:(id (^)(id memo, id object))reduce
 {
+	CBH_INSTRUMENT(@"NSOrderedSet", reduce, [self initial:initial reduce:reduce]);
+
 	id result = initial;
 
 	for (id object in self)
@@ -114,6 +158,89 @@
 	return result;
 }
 
+- (id)initial:(id)initial associativeReduce:(id (^)(id lhs, id rhs))combine executor:(CBHMapReduceExecutor *)executor
+{
+	CBH_INSTRUMENT(@"NSOrderedSet", combine, [self initial:initial associativeReduce:combine executor:executor]);
+
+	return [[self array] initial:initial associativeReduce:combine executor:executor];
+}
+
+
+#pragma mark - Scanning
+
+- (NSArray *)initial:(id)initial scan:(id (^)(id accumulated, id object))scan
+{
+	CBH_INSTRUMENT(@"NSOrderedSet", scan, [self initial:initial scan:scan]);
+
+	return [[self array] initial:initial scan:scan];
+}
+
+- (NSArray *)initial:(id)initial exclusiveScan:(id (^)(id accumulated, id object))scan
+{
+	CBH_INSTRUMENT(@"NSOrderedSet", scan, [self initial:initial exclusiveScan:scan]);
+
+	return [[self array] initial:initial exclusiveScan:scan];
+}
+
+- (NSData *)initialDouble:(double)initial scan:(double (^)(double accumulated, id object))scan
+{
+	CBH_INSTRUMENT(@"NSOrderedSet", scan, [self initialDouble:initial scan:scan]);
+
+	return [[self array] initialDouble:initial scan:scan];
+}
+
+- (NSData *)initialDouble:(double)initial exclusiveScan:(double (^)(double accumulated, id object))scan
+{
+	CBH_INSTRUMENT(@"NSOrderedSet", scan, [self initialDouble:initial exclusiveScan:scan]);
+
+	return [[self array] initialDouble:initial exclusiveScan:scan];
+}
+
+- (NSArray *)initial:(id)initial associativeScan:(id (^)(id lhs, id rhs))combine executor:(CBHMapReduceExecutor *)executor
+{
+	CBH_INSTRUMENT(@"NSOrderedSet", combine, [self initial:initial associativeScan:combine executor:executor]);
+
+	return [[self array] initial:initial associativeScan:combine executor:executor];
+}
+
+- (NSData *)initialDouble:(double)initial value:(double (^)(id object))value associativeScan:(double (^)(double lhs, double rhs))combine executor:(CBHMapReduceExecutor *)executor
+{
+	CBH_INSTRUMENT_PAIR(@"NSOrderedSet", value, combine, [self initialDouble:initial value:value associativeScan:combine executor:executor]);
+
+	return [[self array] initialDouble:initial value:value associativeScan:combine executor:executor];
+}
+
+
+#pragma mark - Windowing
+
+- (NSArray *)chunksOfSize:(NSUInteger)size
+{
+	CBH_INSTRUMENT_CALL(@"NSOrderedSet", [self chunksOfSize:size]);
+
+	return [[self array] chunksOfSize:size];
+}
+
+- (NSArray *)windowsOfSize:(NSUInteger)size step:(NSUInteger)step
+{
+	CBH_INSTRUMENT_CALL(@"NSOrderedSet", [self windowsOfSize:size step:step]);
+
+	return [[self array] windowsOfSize:size step:step];
+}
+
+- (NSArray *)windowedReduceOfSize:(NSUInteger)size initial:(id)initial add:(id (^)(id accumulated, id object))add remove:(id (^)(id accumulated, id object))remove
+{
+	CBH_INSTRUMENT_PAIR(@"NSOrderedSet", add, remove, [self windowedReduceOfSize:size initial:initial add:add remove:remove]);
+
+	return [[self array] windowedReduceOfSize:size initial:initial add:add remove:remove];
+}
+
+- (NSData *)windowedReduceOfSize:(NSUInteger)size initialDouble:(double)initial add:(double (^)(double accumulated, id object))add remove:(double (^)(double accumulated, id object))remove
+{
+	CBH_INSTRUMENT_PAIR(@"NSOrderedSet", add, remove, [self windowedReduceOfSize:size initialDouble:initial add:add remove:remove]);
+
+	return [[self array] windowedReduceOfSize:size initialDouble:initial add:add remove:remove];
+}
+
 
 #pragma mark - Collection Conversion
 
@@ -124,7 +251,7 @@
 
 - (NSMutableArray *)toMutableArray
 {
-	return [self mutableArrayByMapping:^id(id object) { return object; }];
+	return [[NSMutableArray alloc] initWithArray:[self array]];
 }
 
 
@@ -135,7 +262,7 @@
 
 - (NSMutableSet *)toMutableSet
 {
-	return [self mutableSetByMapping:^id(id object) { return object; }];
+	return [[NSMutableSet alloc] initWithArray:[self array]];
 }
 
 @end
@@ -147,6 +274,8 @@
 
 - (instancetype)map:(id (^)(id object))transform
 {
+	CBH_INSTRUMENT(@"NSMutableOrderedSet", transform, [self map:transform]);
+
 	[self enumerateObjectsUsingBlock:^(id object, NSUInteger idx, BOOL *stop) {
 		id mapping = transform(object);
 		if ( object == mapping ) { return; }
@@ -159,6 +288,8 @@
 
 - (instancetype)compactMap:(id (^)(id object))transform
 {
+	CBH_INSTRUMENT(@"NSMutableOrderedSet", transform, [self compactMap:transform]);
+
 	NSMutableIndexSet *removals = [NSMutableIndexSet indexSet];
 
 	[self enumerateObjectsUsingBlock:^(id object, NSUInteger idx, BOOL *stop) {
@@ -183,6 +314,8 @@
 
 - (instancetype)filter:(BOOL (^)(id object))predicate
 {
+	CBH_INSTRUMENT(@"NSMutableOrderedSet", predicate, [self filter:predicate]);
+
 	NSMutableIndexSet *removals = [NSMutableIndexSet indexSet];
 
 	[self enumerateObjectsUsingBlock:^(id object, NSUInteger idx, BOOL *stop) {
@@ -193,4 +326,32 @@
 	return self;
 }
 
+- (instancetype)filter:(BOOL (^)(id object))predicate executor:(CBHMapReduceExecutor *)executor
+{
+	CBH_INSTRUMENT(@"NSMutableOrderedSet", predicate, [self filter:predicate executor:executor]);
+
+	NSArray *survivors = CBHFilterConcurrently([self array], predicate, executor, [NSArray class]);
+	if ( [survivors count] == [self count] ) { return self; }
+
+	[self removeAllObjects];
+	[self addObjectsFromArray:survivors];
+
+	return self;
+}
+
+
+#pragma mark - Views
+
+- (CBHArrayView *)filteredViewUsingPredicate:(BOOL (^)(id object))predicate
+{
+	return [self mappedViewUsingTransform:^id (id object) {
+		return ( predicate(object) ) ? object : nil;
+	}];
+}
+
+- (CBHArrayView *)mappedViewUsingTransform:(id (^)(id object))transform
+{
+	return [[CBHArrayView alloc] initWithSource:self transform:transform];
+}
+
 @end
@@ -18,6 +18,9 @@
 
 @import Foundation;
 
+#import <CBHMapReduceKit/CBHJoinOptions.h>
+#import <CBHMapReduceKit/CBHMapReduceExecutor.h>
+
 
 NS_ASSUME_NONNULL_BEGIN
 
@@ -41,6 +44,15 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (NSMutableSet<id> *)mutableSetByMapping:(nullable id (^)(ElementType object))transform;
 
+/** Returns a new set containing the non-`nil` results of calling the given transformation with each element of this sequence, transforming the elements concurrently.
+ *
+ * @param transform     A closure that accepts an element of this sequence as its parameter and returns a transformed value of the same or of a different type. It may be called concurrently from multiple threads.
+ * @param executor      The executor that schedules the transformations.
+ *
+ * @return              A new set of the non-`nil` results of calling `transform` with each element of the sequence.
+ */
+- (NSSet<id> *)setByMapping:(nullable id (^)(ElementType object))transform executor:(CBHMapReduceExecutor *)executor;
+
 
 /** Returns a new array containing the non-`nil` results of calling the given transformation with each element of this sequence.
  *
@@ -94,6 +106,15 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (NSMutableSet<ElementType> *)mutableSetByFiltering:(BOOL (^)(ElementType object))predicate;
 
+/** Returns a new set containing the elements of the set that satisfy the given predicate, evaluating the predicate concurrently.
+ *
+ * @param predicate     A closure that takes an element as its argument and returns a Boolean value indicating whether the element should be included in the returned set. It may be called concurrently from multiple threads.
+ * @param executor      The executor that schedules the evaluations.
+ *
+ * @return              A new set of the elements that `predicate` allows.
+ */
+- (NSSet<ElementType> *)setByFiltering:(BOOL (^)(ElementType object))predicate executor:(CBHMapReduceExecutor *)executor;
+
 
 #pragma mark - Reducing
 
@@ -106,6 +127,170 @@ NS_ASSUME_NONNULL_BEGIN
  */
 - (nullable id)initial:(nullable id)initial reduce:(nullable id (^)(id __nullable accumulated, ElementType object))reduce;
 
+/** Returns the result of combining the elements of the set using the given associative closure, computed concurrently.
+ *
+ * Each chunk of the set is reduced on its own and the results of the chunks are then combined, starting from `initial`.
+ *
+ * @param initial   The value to use as the initial accumulating value.
+ * @param combine   An associative closure that returns the combination of two accumulated values, where elements are themselves accumulated values. It may be called concurrently from multiple threads.
+ * @param executor  The executor to run the chunks on.
+ *
+ * @return          The final accumulated value. If the set has no elements, the result is `initial`.
+ */
+- (nullable id)initial:(nullable id)initial associativeReduce:(nullable id (^)(id __nullable lhs, id rhs))combine executor:(CBHMapReduceExecutor *)executor;
+
+
+#pragma mark - Joining
+
+/** Returns a new array containing the non-`nil` results of combining each pair of elements from the receiver and another collection whose keys are equal.
+ *
+ * A hash table is built over the smaller of the two collections and the larger one is streamed through it. The results follow the order of the receiver, with the matches of each element in the order of `other`.
+ *
+ * @param other         The collection to join the receiver with.
+ * @param leftKey       A closure that returns the key of an element of the receiver. Elements with a `nil` key are never matched.
+ * @param rightKey      A closure that returns the key of an element of `other`. Elements with a `nil` key are never matched.
+ * @param combine       A closure that accepts a matching pair of elements and returns a combined value.
+ *
+ * @return              A new array of the non-`nil` results of calling `combine` with each matching pair.
+ */
+- (NSArray<id> *)joinWith:(id<NSFastEnumeration>)other leftKey:(nullable id (^)(ElementType object))leftKey rightKey:(nullable id (^)(id object))rightKey combine:(nullable id (^)(ElementType left, id right))combine;
+
+/** Returns a new array containing the non-`nil` results of combining each pair of elements from the receiver and another collection whose keys are equal.
+ *
+ * A hash table is built over the smaller of the two collections and the larger one is streamed through it. The results follow the order of the receiver, with the matches of each element in the order of `other`.
+ *
+ * @param other         The collection to join the receiver with.
+ * @param leftKey       A closure that returns the key of an element of the receiver. Elements with a `nil` key are never matched.
+ * @param rightKey      A closure that returns the key of an element of `other`. Elements with a `nil` key are never matched.
+ * @param options       The options to perform the join with.
+ * @param combine       A closure that accepts a matching pair of elements and returns a combined value.
+ *
+ * @return              A new array of the non-`nil` results of calling `combine` with each matching pair.
+ */
+- (NSArray<id> *)joinWith:(id<NSFastEnumeration>)other leftKey:(nullable id (^)(ElementType object))leftKey rightKey:(nullable id (^)(id object))rightKey options:(CBHJoinOptions)options combine:(nullable id (^)(ElementType left, id right))combine;
+
+/** Returns a new array containing the non-`nil` results of combining each pair of elements from the receiver and another collection whose keys are equal.
+ *
+ * A hash table is built over the smaller of the two collections and the larger one is streamed through it. The results follow the order of the receiver, with the matches of each element in the order of `other`.
+ *
+ * @param other         The collection to join the receiver with.
+ * @param leftKey       A closure that returns the key of an element of the receiver. Elements with a `nil` key are never matched.
+ * @param rightKey      A closure that returns the key of an element of `other`. Elements with a `nil` key are never matched.
+ * @param executor      The executor that probes partitions of the streamed collection concurrently. The key and combine closures may be called concurrently from multiple threads.
+ * @param combine       A closure that accepts a matching pair of elements and returns a combined value.
+ *
+ * @return              A new array of the non-`nil` results of calling `combine` with each matching pair.
+ */
+- (NSArray<id> *)joinWith:(id<NSFastEnumeration>)other leftKey:(nullable id (^)(ElementType object))leftKey rightKey:(nullable id (^)(id object))rightKey executor:(CBHMapReduceExecutor *)executor combine:(nullable id (^)(ElementType left, id right))combine;
+
+
+/** Returns a new array containing the non-`nil` results of combining each element of the receiver with the elements of another collection whose keys are equal.
+ *
+ * Elements of the receiver without a match are combined with `nil`.
+ *
+ * @param other         The collection to join the receiver with.
+ * @param leftKey       A closure that returns the key of an element of the receiver. Elements with a `nil` key are never matched.
+ * @param rightKey      A closure that returns the key of an element of `other`. Elements with a `nil` key are never matched.
+ * @param combine       A closure that accepts an element of the receiver and its match, or `nil`, and returns a combined value.
+ *
+ * @return              A new array of the non-`nil` results of calling `combine` with each element of the receiver and its matches.
+ */
+- (NSArray<id> *)leftOuterJoinWith:(id<NSFastEnumeration>)other leftKey:(nullable id (^)(ElementType object))leftKey rightKey:(nullable id (^)(id object))rightKey combine:(nullable id (^)(ElementType left, id __nullable right))combine;
+
+/** Returns a new array containing the non-`nil` results of combining each element of the receiver with the elements of another collection whose keys are equal.
+ *
+ * Elements of the receiver without a match are combined with `nil`.
+ *
+ * @param other         The collection to join the receiver with.
+ * @param leftKey       A closure that returns the key of an element of the receiver. Elements with a `nil` key are never matched.
+ * @param rightKey      A closure that returns the key of an element of `other`. Elements with a `nil` key are never matched.
+ * @param options       The options to perform the join with.
+ * @param combine       A closure that accepts an element of the receiver and its match, or `nil`, and returns a combined value.
+ *
+ * @return              A new array of the non-`nil` results of calling `combine` with each element of the receiver and its matches.
+ */
+- (NSArray<id> *)leftOuterJoinWith:(id<NSFastEnumeration>)other leftKey:(nullable id (^)(ElementType object))leftKey rightKey:(nullable id (^)(id object))rightKey options:(CBHJoinOptions)options combine:(nullable id (^)(ElementType left, id __nullable right))combine;
+
+/** Returns a new array containing the non-`nil` results of combining each element of the receiver with the elements of another collection whose keys are equal.
+ *
+ * Elements of the receiver without a match are combined with `nil`.
+ *
+ * @param other         The collection to join the receiver with.
+ * @param leftKey       A closure that returns the key of an element of the receiver. Elements with a `nil` key are never matched.
+ * @param rightKey      A closure that returns the key of an element of `other`. Elements with a `nil` key are never matched.
+ * @param executor      The executor that probes partitions of the streamed collection concurrently. The key and combine closures may be called concurrently from multiple threads.
+ * @param combine       A closure that accepts an element of the receiver and its match, or `nil`, and returns a combined value.
+ *
+ * @return              A new array of the non-`nil` results of calling `combine` with each element of the receiver and its matches.
+ */
+- (NSArray<id> *)leftOuterJoinWith:(id<NSFastEnumeration>)other leftKey:(nullable id (^)(ElementType object))leftKey rightKey:(nullable id (^)(id object))rightKey executor:(CBHMapReduceExecutor *)executor combine:(nullable id (^)(ElementType left, id __nullable right))combine;
+
+
+/** Returns a new set containing the elements of the receiver that have at least one element in another collection with an equal key.
+ *
+ * @param other         The collection to join the receiver with.
+ * @param leftKey       A closure that returns the key of an element of the receiver. Elements with a `nil` key are never matched.
+ * @param rightKey      A closure that returns the key of an element of `other`. Elements with a `nil` key are never matched.
+ *
+ * @return              A new set of the elements of the receiver that have a match.
+ */
+- (NSSet<ElementType> *)semiJoinWith:(id<NSFastEnumeration>)other leftKey:(nullable id (^)(ElementType object))leftKey rightKey:(nullable id (^)(id object))rightKey;
+
+/** Returns a new set containing the elements of the receiver that have at least one element in another collection with an equal key.
+ *
+ * @param other         The collection to join the receiver with.
+ * @param leftKey       A closure that returns the key of an element of the receiver. Elements with a `nil` key are never matched.
+ * @param rightKey      A closure that returns the key of an element of `other`. Elements with a `nil` key are never matched.
+ * @param options       The options to perform the join with.
+ *
+ * @return              A new set of the elements of the receiver that have a match.
+ */
+- (NSSet<ElementType> *)semiJoinWith:(id<NSFastEnumeration>)other leftKey:(nullable id (^)(ElementType object))leftKey rightKey:(nullable id (^)(id object))rightKey options:(CBHJoinOptions)options;
+
+/** Returns a new set containing the elements of the receiver that have at least one element in another collection with an equal key.
+ *
+ * @param other         The collection to join the receiver with.
+ * @param leftKey       A closure that returns the key of an element of the receiver. Elements with a `nil` key are never matched.
+ * @param rightKey      A closure that returns the key of an element of `other`. Elements with a `nil` key are never matched.
+ * @param executor      The executor that probes partitions of the streamed collection concurrently. The key closures may be called concurrently from multiple threads.
+ *
+ * @return              A new set of the elements of the receiver that have a match.
+ */
+- (NSSet<ElementType> *)semiJoinWith:(id<NSFastEnumeration>)other leftKey:(nullable id (^)(ElementType object))leftKey rightKey:(nullable id (^)(id object))rightKey executor:(CBHMapReduceExecutor *)executor;
+
+
+/** Returns a new set containing the elements of the receiver that have no element in another collection with an equal key.
+ *
+ * @param other         The collection to join the receiver with.
+ * @param leftKey       A closure that returns the key of an element of the receiver. Elements with a `nil` key are never matched.
+ * @param rightKey      A closure that returns the key of an element of `other`. Elements with a `nil` key are never matched.
+ *
+ * @return              A new set of the elements of the receiver that have no match.
+ */
+- (NSSet<ElementType> *)antiJoinWith:(id<NSFastEnumeration>)other leftKey:(nullable id (^)(ElementType object))leftKey rightKey:(nullable id (^)(id object))rightKey;
+
+/** Returns a new set containing the elements of the receiver that have no element in another collection with an equal key.
+ *
+ * @param other         The collection to join the receiver with.
+ * @param leftKey       A closure that returns the key of an element of the receiver. Elements with a `nil` key are never matched.
+ * @param rightKey      A closure that returns the key of an element of `other`. Elements with a `nil` key are never matched.
+ * @param options       The options to perform the join with.
+ *
+ * @return              A new set of the elements of the receiver that have no match.
+ */
+- (NSSet<ElementType> *)antiJoinWith:(id<NSFastEnumeration>)other leftKey:(nullable id (^)(ElementType object))leftKey rightKey:(nullable id (^)(id object))rightKey options:(CBHJoinOptions)options;
+
+/** Returns a new set containing the elements of the receiver that have no element in another collection with an equal key.
+ *
+ * @param other         The collection to join the receiver with.
+ * @param leftKey       A closure that returns the key of an element of the receiver. Elements with a `nil` key are never matched.
+ * @param rightKey      A closure that returns the key of an element of `other`. Elements with a `nil` key are never matched.
+ * @param executor      The executor that probes partitions of the streamed collection concurrently. The key closures may be called concurrently from multiple threads.
+ *
+ * @return              A new set of the elements of the receiver that have no match.
+ */
+- (NSSet<ElementType> *)antiJoinWith:(id<NSFastEnumeration>)other leftKey:(nullable id (^)(ElementType object))leftKey rightKey:(nullable id (^)(id object))rightKey executor:(CBHMapReduceExecutor *)executor;
+
 
 #pragma mark - Collection Conversion
 
@@ -18,6 +18,11 @@
 
 #import "NSSet+CBHMapReduceKit.h"
 
+#import "NSArray+CBHMapReduceKit.h"
+#import "_CBHFilter.h"
+#import "_CBHMapReduceInstrumentation.h"
+#import "_CBHMapReduceJoin.h"
+
 
 @implementation NSSet (CBHMapReduceKit)
 
@@ -25,11 +30,15 @@
 
 - (NSSet *)setByMapping:(id (^)(id object))transform
 {
+	CBH_INSTRUMENT(@"NSSet", transform, [self setByMapping:transform]);
+
 	return [self mutableSetByMapping:transform];
 }
 
 - (NSMutableSet *)mutableSetByMapping:(id (^)(id object))transform
 {
+	CBH_INSTRUMENT(@"NSSet", transform, [self mutableSetByMapping:transform]);
+
 	NSMutableSet *resultSet = [[NSMutableSet alloc] initWithCapacity:[self count]];
 
 	for (id object in self)
@@ -41,14 +50,25 @@
 	return resultSet;
 }
 
+- (NSSet *)setByMapping:(id (^)(id object))transform executor:(CBHMapReduceExecutor *)executor
+{
+	CBH_INSTRUMENT(@"NSSet", transform, [self setByMapping:transform executor:executor]);
+
+	return [[NSSet alloc] initWithArray:[[self allObjects] arrayByMapping:transform executor:executor]];
+}
+
 
 - (NSArray *)arrayByMapping:(id (^)(id object))transform
 {
+	CBH_INSTRUMENT(@"NSSet", transform, [self arrayByMapping:transform]);
+
 	return [self mutableArrayByMapping:transform];
 }
 
 - (NSMutableArray *)mutableArrayByMapping:(id (^)(id object))transform
 {
+	CBH_INSTRUMENT(@"NSSet", transform, [self mutableArrayByMapping:transform]);
+
 	NSMutableArray *result = [[NSMutableArray alloc] initWithCapacity:[self count]];
 
 	for (id object in self)
@@ -63,11 +83,15 @@
 
 - (NSOrderedSet *)orderedSetByMapping:(id (^)(id object))transform
 {
+	CBH_INSTRUMENT(@"NSSet", transform, [self orderedSetByMapping:transform]);
+
 	return [self mutableOrderedSetByMapping:transform];
 }
 
 - (NSMutableOrderedSet *)mutableOrderedSetByMapping:(id (^)(id object))transform
 {
+	CBH_INSTRUMENT(@"NSSet", transform, [self mutableOrderedSetByMapping:transform]);
+
 	NSMutableOrderedSet *result = [[NSMutableOrderedSet alloc] initWithCapacity:[self count]];
 
 	for (id object in self)
@@ -84,11 +108,15 @@
 
 - (NSSet *)setByFiltering:(BOOL (^)(id object))predicate
 {
+	CBH_INSTRUMENT(@"NSSet", predicate, [self setByFiltering:predicate]);
+
 	return [self mutableSetByFiltering:predicate];
 }
 
 - (NSMutableSet *)mutableSetByFiltering:(BOOL (^)(id object))predicate
 {
+	CBH_INSTRUMENT(@"NSSet", predicate, [self mutableSetByFiltering:predicate]);
+
 	NSMutableSet *result = [[NSMutableSet alloc] initWithCapacity:[self count]];
 
 	for (id object in self)
@@ -99,11 +127,20 @@
 	return result;
 }
 
+- (NSSet *)setByFiltering:(BOOL (^)(id object))predicate executor:(CBHMapReduceExecutor *)executor
+{
+	CBH_INSTRUMENT(@"NSSet", predicate, [self setByFiltering:predicate executor:executor]);
+
+	return CBHFilterConcurrently([self allObjects], predicate, executor, [NSSet class]);
+}
+
 
 #pragma mark - Reducing
 
 - (id)initial:(id)initial reduce:(id (^)(id accumulated, id object))reduce
 {
+	CBH_INSTRUMENT(@"NSSet", reduce, [self initial:initial reduce:reduce]);
+
 	id accumulated = initial;
 
 	for (id object in self)
@@ -114,6 +151,83 @@
 	return accumulated;
 }
 
+- (id)initial:(id)initial associativeReduce:(id (^)(id lhs, id rhs))combine executor:(CBHMapReduceExecutor *)executor
+{
+	CBH_INSTRUMENT(@"NSSet", combine, [self initial:initial associativeReduce:combine executor:executor]);
+
+	return [[self allObjects] initial:initial associativeReduce:combine executor:executor];
+}
+
+
+#pragma mark - Joining
+
+- (NSArray *)joinWith:(id<NSFastEnumeration>)other leftKey:(id (^)(id object))leftKey rightKey:(id (^)(id object))rightKey combine:(id (^)(id left, id right))combine
+{
+	return [self joinWith:other leftKey:leftKey rightKey:rightKey options:CBHJoinOptionsNone combine:combine];
+}
+
+- (NSArray *)joinWith:(id<NSFastEnumeration>)other leftKey:(id (^)(id object))leftKey rightKey:(id (^)(id object))rightKey options:(CBHJoinOptions)options combine:(id (^)(id left, id right))combine
+{
+	CBHMapReduceExecutor *executor = ( options & CBHJoinOptionsConcurrent ) ? [CBHMapReduceExecutor defaultExecutor] : nil;
+	return CBHJoin(CBHJoinKindInner, self, [self count], other, CBHJoinCount(other), leftKey, rightKey, combine, executor);
+}
+
+- (NSArray *)joinWith:(id<NSFastEnumeration>)other leftKey:(id (^)(id object))leftKey rightKey:(id (^)(id object))rightKey executor:(CBHMapReduceExecutor *)executor combine:(id (^)(id left, id right))combine
+{
+	return CBHJoin(CBHJoinKindInner, self, [self count], other, CBHJoinCount(other), leftKey, rightKey, combine, executor);
+}
+
+
+- (NSArray *)leftOuterJoinWith:(id<NSFastEnumeration>)other leftKey:(id (^)(id object))leftKey rightKey:(id (^)(id object))rightKey combine:(id (^)(id left, id right))combine
+{
+	return [self leftOuterJoinWith:other leftKey:leftKey rightKey:rightKey options:CBHJoinOptionsNone combine:combine];
+}
+
+- (NSArray *)leftOuterJoinWith:(id<NSFastEnumeration>)other leftKey:(id (^)(id object))leftKey rightKey:(id (^)(id object))rightKey options:(CBHJoinOptions)options combine:(id (^)(id left, id right))combine
+{
+	CBHMapReduceExecutor *executor = ( options & CBHJoinOptionsConcurrent ) ? [CBHMapReduceExecutor defaultExecutor] : nil;
+	return CBHJoin(CBHJoinKindLeftOuter, self, [self count], other, CBHJoinCount(other), leftKey, rightKey, combine, executor);
+}
+
+- (NSArray *)leftOuterJoinWith:(id<NSFastEnumeration>)other leftKey:(id (^)(id object))leftKey rightKey:(id (^)(id object))rightKey executor:(CBHMapReduceExecutor *)executor combine:(id (^)(id left, id right))combine
+{
+	return CBHJoin(CBHJoinKindLeftOuter, self, [self count], other, CBHJoinCount(other), leftKey, rightKey, combine, executor);
+}
+
+
+- (NSSet *)semiJoinWith:(id<NSFastEnumeration>)other leftKey:(id (^)(id object))leftKey rightKey:(id (^)(id object))rightKey
+{
+	return [self semiJoinWith:other leftKey:leftKey rightKey:rightKey options:CBHJoinOptionsNone];
+}
+
+- (NSSet *)semiJoinWith:(id<NSFastEnumeration>)other leftKey:(id (^)(id object))leftKey rightKey:(id (^)(id object))rightKey options:(CBHJoinOptions)options
+{
+	CBHMapReduceExecutor *executor = ( options & CBHJoinOptionsConcurrent ) ? [CBHMapReduceExecutor defaultExecutor] : nil;
+	return [[NSSet alloc] initWithArray:CBHJoin(CBHJoinKindSemi, self, [self count], other, CBHJoinCount(other), leftKey, rightKey, nil, executor)];
+}
+
+- (NSSet *)semiJoinWith:(id<NSFastEnumeration>)other leftKey:(id (^)(id object))leftKey rightKey:(id (^)(id object))rightKey executor:(CBHMapReduceExecutor *)executor
+{
+	return [[NSSet alloc] initWithArray:CBHJoin(CBHJoinKindSemi, self, [self count], other, CBHJoinCount(other), leftKey, rightKey, nil, executor)];
+}
+
+
+- (NSSet *)antiJoinWith:(id<NSFastEnumeration>)other leftKey:(id (^)(id object))leftKey rightKey:(id (^)(id object))rightKey
+{
+	return [self antiJoinWith:other leftKey:leftKey rightKey:rightKey options:CBHJoinOptionsNone];
+}
+
+- (NSSet *)antiJoinWith:(id<NSFastEnumeration>)other leftKey:(id (^)(id object))leftKey rightKey:(id (^)(id object))rightKey options:(CBHJoinOptions)options
+{
+	CBHMapReduceExecutor *executor = ( options & CBHJoinOptionsConcurrent ) ? [CBHMapReduceExecutor defaultExecutor] : nil;
+	return [[NSSet alloc] initWithArray:CBHJoin(CBHJoinKindAnti, self, [self count], other, CBHJoinCount(other), leftKey, rightKey, nil, executor)];
+}
+
+- (NSSet *)antiJoinWith:(id<NSFastEnumeration>)other leftKey:(id (^)(id object))leftKey rightKey:(id (^)(id object))rightKey executor:(CBHMapReduceExecutor *)executor
+{
+	return [[NSSet alloc] initWithArray:CBHJoin(CBHJoinKindAnti, self, [self count], other, CBHJoinCount(other), leftKey, rightKey, nil, executor)];
+}
+
 
 #pragma mark - Collection Conversion
 
@@ -124,7 +238,7 @@
 
 - (NSMutableArray *)toMutableArray
 {
-	return [self mutableArrayByMapping:^id(id object) { return object; }];
+	return [[self allObjects] mutableCopy];
 }
 
 
@@ -135,7 +249,7 @@
 
 - (NSMutableOrderedSet *)toMutableOrderedSet
 {
-	return [self mutableOrderedSetByMapping:^id(id object) { return object; }];
+	return [[NSMutableOrderedSet alloc] initWithSet:self];
 }
 
 @end
@@ -148,6 +262,8 @@
 
 - (instancetype)map:(id (^)(id object))transform
 {
+	CBH_INSTRUMENT(@"NSMutableSet", transform, [self map:transform]);
+
 	NSMutableArray *additions = [NSMutableArray arrayWithCapacity:[self count]];
 
 	[self enumerateObjectsUsingBlock:^(id object, BOOL *stop) {
@@ -164,6 +280,8 @@
 
 - (instancetype)compactMap:(id (^)(id object))transform
 {
+	CBH_INSTRUMENT(@"NSMutableSet", transform, [self compactMap:transform]);
+
 	NSMutableArray *additions = [NSMutableArray arrayWithCapacity:[self count]];
 
 	[self enumerateObjectsUsingBlock:^(id object, BOOL *stop) {
@@ -184,6 +302,8 @@
 
 - (instancetype)filter:(BOOL (^)(id object))predicate
 {
+	CBH_INSTRUMENT(@"NSMutableSet", predicate, [self filter:predicate]);
+
 	NSMutableSet *removals = [NSMutableSet set];
 
 	[self enumerateObjectsUsingBlock:^(id object, BOOL *stop) {
@@ -0,0 +1,58 @@
+//  _CBHArrayView.h
+//  CBHMapReduceKit
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+#import "CBHArrayView.h"
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+@interface CBHArrayView ()
+
+/** Initializes a view over a mutable array or mutable ordered set.
+ *
+ * @param source        The `NSMutableArray` or `NSMutableOrderedSet` to view. Ordered sets are read through their live `array` proxy.
+ * @param transform     A closure that maps an element of the source to an element of the view, or `nil` to exclude it.
+ *
+ * @return              The initialized view.
+ */
+- (instancetype)initWithSource:(id)source transform:(nullable id (^)(id object))transform;
+
+
+#pragma mark - Updating
+
+/** Updates the view after objects were inserted into its source.
+ *
+ * @param indexes   The indexes of the inserted objects in the source after the insertion.
+ */
+- (void)sourceDidInsertObjectsAtIndexes:(NSIndexSet *)indexes;
+
+/** Updates the view after objects were removed from its source.
+ *
+ * @param indexes   The indexes of the removed objects in the source before the removal.
+ */
+- (void)sourceDidRemoveObjectsAtIndexes:(NSIndexSet *)indexes;
+
+/** Updates the view after objects in its source were replaced.
+ *
+ * @param indexes   The indexes of the replaced objects in the source.
+ */
+- (void)sourceDidReplaceObjectsAtIndexes:(NSIndexSet *)indexes;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,35 @@
+//  _CBHBatchEnumeration.h
+//  CBHMapReduceKit
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+@import Foundation;
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+/** Enumerates a collection in batches, raising if it is mutated.
+ *
+ * Collections and enumerators with their own fast enumeration, such as those of arrays, sets and dictionaries, are asked for
+ * progressively larger batches while they keep filling the buffer. Enumerators that only implement `nextObject` are pulled through it
+ * into batches that start small and grow in the same way, instead of one object per call.
+ *
+ * @param collection    The collection to enumerate.
+ * @param block         A closure called with each batch of objects, which are only valid for the duration of the call.
+ */
+void CBHEnumerateInBatches(id<NSFastEnumeration> collection, void (NS_NOESCAPE ^block)(id __unsafe_unretained _Nonnull const * _Nonnull objects, NSUInteger count));
+
+NS_ASSUME_NONNULL_END
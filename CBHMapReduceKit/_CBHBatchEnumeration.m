@@ -0,0 +1,125 @@
+//  _CBHBatchEnumeration.m
+//  CBHMapReduceKit
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+#import "_CBHBatchEnumeration.h"
+
+#import <objc/runtime.h>
+
+
+/// The length of the first batch asked for, matching that used by `for...in`.
+#define CBHBatchInitialLength 16
+
+/// The length at which batches pulled from enumerators that only implement `nextObject` stop growing.
+#define CBHBatchFallbackLength 256
+
+/// The length of the batch buffer on the stack, at which batches stop growing.
+#define CBHBatchMaximumLength 1024
+
+
+#pragma mark - Pulling
+
+static BOOL CBHHasFastEnumeration(id<NSFastEnumeration> collection)
+{
+	if ( ![(id)collection isKindOfClass:[NSEnumerator class]] ) { return YES; }
+
+	SEL selector = @selector(countByEnumeratingWithState:objects:count:);
+	IMP inherited = class_getMethodImplementation([NSEnumerator class], selector);
+
+	return class_getMethodImplementation(object_getClass(collection), selector) != inherited;
+}
+
+static void CBHEnumerateFastInBatches(id<NSFastEnumeration> collection, void (NS_NOESCAPE ^block)(id __unsafe_unretained const *objects, NSUInteger count))
+{
+	NSFastEnumerationState state = {0};
+
+	/// The buffer is fixed at its largest length so that nothing on the heap needs freeing if the block throws; only the count asked for grows.
+	id __unsafe_unretained buffer[CBHBatchMaximumLength];
+	NSUInteger length = CBHBatchInitialLength;
+
+	unsigned long mutations = 0;
+	BOOL isStarted = NO;
+
+	for (;;)
+	{
+		NSUInteger count = [collection countByEnumeratingWithState:&state objects:buffer count:length];
+		if ( count == 0 ) { break; }
+
+		if ( !isStarted )
+		{
+			mutations = *state.mutationsPtr;
+			isStarted = YES;
+		}
+		else if ( *state.mutationsPtr != mutations )
+		{
+			objc_enumerationMutation(collection);
+		}
+
+		block(state.itemsPtr, count);
+
+		/// Only a collection that copies into the buffer and fills it can make use of a larger batch.
+		if ( state.itemsPtr != buffer || count < length ) { continue; }
+
+		length = MIN(length * 4, CBHBatchMaximumLength);
+	}
+}
+
+
+static void CBHEnumerateObjectsInBatches(NSEnumerator *enumerator, void (NS_NOESCAPE ^block)(id __unsafe_unretained const *objects, NSUInteger count))
+{
+	id batch[CBHBatchFallbackLength];
+	NSUInteger length = CBHBatchInitialLength;
+	BOOL isFull;
+
+	/// Start small so that the first objects are handed on promptly, and grow while the enumerator keeps filling the batch.
+	do {
+		@autoreleasepool {
+			NSUInteger count = 0;
+
+			for (id object; count < length && (object = [enumerator nextObject]); ++count)
+			{
+				batch[count] = object;
+			}
+
+			if ( count > 0 ) { block(batch, count); }
+
+			for (NSUInteger index = 0; index < count; ++index)
+			{
+				batch[index] = nil;
+			}
+
+			isFull = ( count == length );
+		}
+
+		length = MIN(length * 4, CBHBatchFallbackLength);
+	} while ( isFull );
+}
+
+
+#pragma mark - Batching
+
+void CBHEnumerateInBatches(id<NSFastEnumeration> collection, void (NS_NOESCAPE ^block)(id __unsafe_unretained const *objects, NSUInteger count))
+{
+	if ( CBHHasFastEnumeration(collection) )
+	{
+		CBHEnumerateFastInBatches(collection, block);
+	}
+	else
+	{
+		CBHEnumerateObjectsInBatches((NSEnumerator *)collection, block);
+	}
+}
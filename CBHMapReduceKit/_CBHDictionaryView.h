@@ -0,0 +1,46 @@
+//  _CBHDictionaryView.h
+//  CBHMapReduceKit
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+#import "CBHDictionaryView.h"
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+@interface CBHDictionaryView ()
+
+/** Initializes a view over a mutable dictionary.
+ *
+ * @param source        The mutable dictionary to view.
+ * @param transform     A closure that maps a key-value pair of the source to a value of the view, or `nil` to exclude it.
+ *
+ * @return              The initialized view.
+ */
+- (instancetype)initWithSource:(NSMutableDictionary *)source transform:(nullable id (^)(id key, id value))transform;
+
+
+#pragma mark - Updating
+
+/** Updates the view after the value for a key in its source was added, replaced or removed.
+ *
+ * @param key   The key whose value changed.
+ */
+- (void)sourceDidChangeObjectForKey:(id)key;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,41 @@
+//  _CBHFilter.h
+//  CBHMapReduceKit
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+@import Foundation;
+
+@class CBHMapReduceExecutor;
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+/** Filters an array concurrently, preserving the order of its elements.
+ *
+ * Each chunk of the array records which of its elements satisfy the predicate in a shared bitmap and counts them. The counts are
+ * then summed into the offset of each chunk's first survivor so that the chunks copy their survivors straight into one buffer of
+ * exactly the right length.
+ *
+ * @param array         The array to filter. It must not be mutated while it is being filtered.
+ * @param predicate     A closure that returns whether an element is kept. It may be called concurrently from multiple threads.
+ * @param executor      The executor to run the chunks on.
+ * @param resultClass   The class of the result, which must respond to `initWithObjects:count:`.
+ *
+ * @return              A new instance of `resultClass` holding the elements that `predicate` allows, in the order of the array.
+ */
+id CBHFilterConcurrently(NSArray *array, BOOL (^predicate)(id object), CBHMapReduceExecutor *executor, Class resultClass);
+
+NS_ASSUME_NONNULL_END
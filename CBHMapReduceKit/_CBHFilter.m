@@ -0,0 +1,107 @@
+//  _CBHFilter.m
+//  CBHMapReduceKit
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+#import "_CBHFilter.h"
+
+#import "CBHMapReduceExecutor.h"
+
+
+/// The number of elements tracked by each word of the bitmap.
+#define CBHFilterWordLength 64
+
+/// The number of elements filtered per chunk so each worker is given several chunks. Chunks are whole words of the bitmap so no two share one.
+static inline NSUInteger CBHFilterChunkLength(NSUInteger count, NSUInteger workerCount)
+{
+	NSUInteger chunkCount = MAX(workerCount, (NSUInteger)1) * 4;
+	NSUInteger length = MAX((count + chunkCount - 1) / chunkCount, (NSUInteger)1);
+
+	return (length + CBHFilterWordLength - 1) / CBHFilterWordLength * CBHFilterWordLength;
+}
+
+
+id CBHFilterConcurrently(NSArray *array, BOOL (^predicate)(id object), CBHMapReduceExecutor *executor, Class resultClass)
+{
+	NSUInteger count = [array count];
+	NSUInteger chunkLength = CBHFilterChunkLength(count, [executor workerCount]);
+	NSUInteger chunkCount = (count + chunkLength - 1) / chunkLength;
+
+	uint64_t *bitmap = (uint64_t *)calloc((count + CBHFilterWordLength - 1) / CBHFilterWordLength, sizeof(uint64_t));
+	NSUInteger *offsets = (NSUInteger *)calloc(chunkCount, sizeof(NSUInteger));
+
+	/// Mark the survivors of each chunk and count them.
+	[executor applyRangesOfCount:chunkCount block:^(NSRange range) {
+		for (NSUInteger chunk = range.location; chunk < NSMaxRange(range); ++chunk)
+		{
+			NSUInteger end = MIN((chunk + 1) * chunkLength, count);
+			NSUInteger kept = 0;
+
+			for (NSUInteger start = chunk * chunkLength; start < end; start += CBHFilterWordLength)
+			{
+				NSUInteger wordEnd = MIN(start + CBHFilterWordLength, end);
+				uint64_t word = 0;
+
+				for (NSUInteger i = start; i < wordEnd; ++i)
+				{
+					if ( predicate([array objectAtIndex:i]) ) { word |= (uint64_t)1 << (i - start); }
+				}
+
+				bitmap[start / CBHFilterWordLength] = word;
+				kept += (NSUInteger)__builtin_popcountll(word);
+			}
+
+			offsets[chunk] = kept;
+		}
+	}];
+
+	/// Replace each count with the number of survivors in the chunks before it.
+	NSUInteger total = 0;
+
+	for (NSUInteger chunk = 0; chunk < chunkCount; ++chunk)
+	{
+		NSUInteger kept = offsets[chunk];
+		offsets[chunk] = total;
+		total += kept;
+	}
+
+	__strong id *survivors = (__strong id *)calloc(MAX(total, (NSUInteger)1), sizeof(id));
+
+	[executor applyRangesOfCount:chunkCount block:^(NSRange range) {
+		for (NSUInteger chunk = range.location; chunk < NSMaxRange(range); ++chunk)
+		{
+			NSUInteger end = MIN((chunk + 1) * chunkLength, count);
+			NSUInteger offset = offsets[chunk];
+
+			for (NSUInteger start = chunk * chunkLength; start < end; start += CBHFilterWordLength)
+			{
+				for (uint64_t word = bitmap[start / CBHFilterWordLength]; word != 0; word &= word - 1)
+				{
+					survivors[offset++] = [array objectAtIndex:start + (NSUInteger)__builtin_ctzll(word)];
+				}
+			}
+		}
+	}];
+
+	id result = [[resultClass alloc] initWithObjects:survivors count:total];
+
+	for (NSUInteger i = 0; i < total; ++i) { survivors[i] = nil; }
+	free(survivors);
+	free(offsets);
+	free(bitmap);
+
+	return result;
+}
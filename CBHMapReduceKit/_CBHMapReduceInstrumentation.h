@@ -0,0 +1,131 @@
+//  _CBHMapReduceInstrumentation.h
+//  CBHMapReduceKit
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+@import Foundation;
+
+#import <stdatomic.h>
+
+#import "CBHMapReduceInstrumentation.h"
+
+
+/// The closure types accepted by the instrumented methods, left unannotated to match their implementations.
+typedef id (^CBHInstrumentedTransform)(id object);
+typedef BOOL (^CBHInstrumentedPredicate)(id object);
+typedef id (^CBHInstrumentedPairTransform)(id first, id second);
+typedef BOOL (^CBHInstrumentedPairPredicate)(id first, id second);
+typedef double (^CBHInstrumentedDoubleValue)(id object);
+typedef double (^CBHInstrumentedDoubleAccumulator)(double accumulated, id object);
+typedef double (^CBHInstrumentedDoubleCombine)(double lhs, double rhs);
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// The number of installed observers, global and scoped. Instrumentation is skipped after a single load while it is zero.
+extern _Atomic(NSUInteger) CBHInstrumentationObserverCount;
+
+/** Begins a record of a call if an observer is installed for the current thread and no other call is being recorded on it.
+ *
+ * @param category  The name of the class the method belongs to.
+ * @param selector  The selector of the method.
+ * @param frame     The frame address of the method, used to tell calls nested in the current record from later calls.
+ *
+ * @return          The record to complete with `CBHInstrumentationEnd`, or `nil` if the call should not be recorded.
+ */
+CBHMapReduceCallRecord * _Nullable CBHInstrumentationBegin(NSString *category, SEL selector, void *frame);
+
+/** Completes a record and tells its observer about it.
+ *
+ * @param record    The record returned by `CBHInstrumentationBegin`.
+ * @param receiver  The receiver of the call.
+ * @param result    The result of the call.
+ *
+ * @return          `result`.
+ */
+id _Nullable CBHInstrumentationEnd(CBHMapReduceCallRecord *record, id receiver, id _Nullable result);
+
+/** Forgets a record if it is still the one in progress on the current thread so that later calls on it are recorded.
+ *
+ * Used as the cleanup of the record's variable so that it also runs when the call is left early.
+ *
+ * @param record    A pointer to the variable holding the record returned by `CBHInstrumentationBegin`.
+ */
+void CBHInstrumentationClearRecord(CBHMapReduceCallRecord * _Nullable __strong * _Nonnull record);
+
+/** Wraps a closure so that the time spent in it, and if `isCounted` its calls, are added to a record. A `nil` closure stays `nil`.
+ */
+__attribute__((overloadable)) CBHInstrumentedTransform CBHInstrumentationWrap(CBHMapReduceCallRecord *record, CBHInstrumentedTransform transform, BOOL isCounted);
+__attribute__((overloadable)) CBHInstrumentedPredicate CBHInstrumentationWrap(CBHMapReduceCallRecord *record, CBHInstrumentedPredicate predicate, BOOL isCounted);
+__attribute__((overloadable)) CBHInstrumentedPairTransform CBHInstrumentationWrap(CBHMapReduceCallRecord *record, CBHInstrumentedPairTransform transform, BOOL isCounted);
+__attribute__((overloadable)) CBHInstrumentedPairPredicate CBHInstrumentationWrap(CBHMapReduceCallRecord *record, CBHInstrumentedPairPredicate predicate, BOOL isCounted);
+__attribute__((overloadable)) CBHInstrumentedDoubleValue CBHInstrumentationWrap(CBHMapReduceCallRecord *record, CBHInstrumentedDoubleValue value, BOOL isCounted);
+__attribute__((overloadable)) CBHInstrumentedDoubleAccumulator CBHInstrumentationWrap(CBHMapReduceCallRecord *record, CBHInstrumentedDoubleAccumulator accumulator, BOOL isCounted);
+__attribute__((overloadable)) CBHInstrumentedDoubleCombine CBHInstrumentationWrap(CBHMapReduceCallRecord *record, CBHInstrumentedDoubleCombine combine, BOOL isCounted);
+
+
+/** Begins a record of the enclosing method call, or leaves the enclosing `do` block when the call is not to be recorded.
+ *
+ * The gate is a single relaxed load of a global. The thread's own observer is only looked up once an observer is installed
+ * somewhere. The record is forgotten when it goes out of scope, including when the framework is built with exceptions and the
+ * call throws. Otherwise a record abandoned by a throw is recognized by its frame and replaced by the next call.
+ */
+#define CBH_INSTRUMENT_BEGIN(category) \
+		if ( __builtin_expect(atomic_load_explicit(&CBHInstrumentationObserverCount, memory_order_relaxed) == 0, 1) ) { break; } \
+\
+		CBHMapReduceCallRecord *cbh_record __attribute__((cleanup(CBHInstrumentationClearRecord))) = CBHInstrumentationBegin((category), _cmd, __builtin_frame_address(0)); \
+		if ( !cbh_record ) { break; }
+
+/** Records the enclosing method call when instrumentation is enabled.
+ *
+ * When an observer is installed for the current thread, wraps `block` and returns the result of `expression`, which should call
+ * the enclosing method again with the wrapped closure. Otherwise falls through at the cost of one branch.
+ */
+#define CBH_INSTRUMENT(category, block, expression) \
+	do \
+	{ \
+		CBH_INSTRUMENT_BEGIN(category) \
+\
+		block = CBHInstrumentationWrap(cbh_record, block, YES); \
+		return CBHInstrumentationEnd(cbh_record, self, (expression)); \
+	} while ( 0 )
+
+/** Records the enclosing method call of a method taking two closures when instrumentation is enabled.
+ *
+ * Calls of `block` are counted as the inputs of the call. The time spent in `other` is added to the time spent in closures but
+ * its calls are not counted.
+ */
+#define CBH_INSTRUMENT_PAIR(category, block, other, expression) \
+	do \
+	{ \
+		CBH_INSTRUMENT_BEGIN(category) \
+\
+		block = CBHInstrumentationWrap(cbh_record, block, YES); \
+		other = CBHInstrumentationWrap(cbh_record, other, NO); \
+		return CBHInstrumentationEnd(cbh_record, self, (expression)); \
+	} while ( 0 )
+
+/** Records the enclosing method call of a method that takes no closure when instrumentation is enabled.
+ */
+#define CBH_INSTRUMENT_CALL(category, expression) \
+	do \
+	{ \
+		CBH_INSTRUMENT_BEGIN(category) \
+\
+		return CBHInstrumentationEnd(cbh_record, self, (expression)); \
+	} while ( 0 )
+
+NS_ASSUME_NONNULL_END
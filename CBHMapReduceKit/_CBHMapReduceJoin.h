@@ -0,0 +1,62 @@
+//  _CBHMapReduceJoin.h
+//  CBHMapReduceKit
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+@import Foundation;
+
+#import "CBHJoinOptions.h"
+
+@class CBHMapReduceExecutor;
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+typedef NS_ENUM(NSUInteger, CBHJoinKind)
+{
+	CBHJoinKindInner,
+	CBHJoinKindLeftOuter,
+	CBHJoinKindSemi,
+	CBHJoinKindAnti,
+};
+
+
+/** Returns the number of elements in a collection, or `NSNotFound` if it can not be known without enumerating it.
+ */
+NSUInteger CBHJoinCount(id<NSFastEnumeration> collection);
+
+/** Performs a hash join of two collections.
+ *
+ * The hash table is built over the side that is known to be smaller, for every kind of join, and the other side is streamed through
+ * it. When the left side is built, each match carries the index of its left element, which is how the left elements without a
+ * match are found for left outer and anti joins. Either way the results follow the order of the left side, with the matches of each
+ * left element in the order of the right side. Keys are compared with `isEqual:` and `hash` and are retained rather than copied.
+ *
+ * @param kind          The kind of join to perform.
+ * @param left          The left collection.
+ * @param leftCount     The number of elements in `left` or `NSNotFound` if unknown.
+ * @param right         The right collection.
+ * @param rightCount    The number of elements in `right` or `NSNotFound` if unknown.
+ * @param leftKey       A closure returning the join key of a left element. Elements with a `nil` key never match.
+ * @param rightKey      A closure returning the join key of a right element. Elements with a `nil` key never match.
+ * @param combine       A closure returning the result of a matched pair. It is not used by semi and anti joins.
+ * @param executor      The executor that probes the streamed side in partitions, or `nil` to probe it serially.
+ *
+ * @return              The non-`nil` combined results, or the matching left elements for semi and anti joins.
+ */
+NSMutableArray *CBHJoin(CBHJoinKind kind, id<NSFastEnumeration> left, NSUInteger leftCount, id<NSFastEnumeration> right, NSUInteger rightCount, id _Nullable (^leftKey)(id object), id _Nullable (^rightKey)(id object), id _Nullable (^ _Nullable combine)(id leftElement, id _Nullable rightElement), CBHMapReduceExecutor * _Nullable executor);
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,360 @@
+//  _CBHMapReduceJoin.m
+//  CBHMapReduceKit
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+#import "_CBHMapReduceJoin.h"
+
+#import "CBHMapReduceExecutor.h"
+
+
+typedef void (^CBHJoinProbe)(id element, NSMutableArray *into);
+
+
+#pragma mark - Buckets
+
+/// Holds the elements of the build side that share a key. Keys with only one element store it directly in the table.
+@interface CBHJoinBucket : NSObject
+{
+	@package
+	NSMutableArray *_elements;
+}
+
+- (instancetype)initWithElement:(id)first element:(id)second;
+
+@end
+
+
+@implementation CBHJoinBucket
+
+- (instancetype)initWithElement:(id)first element:(id)second
+{
+	if ( (self = [super init]) )
+	{
+		_elements = [[NSMutableArray alloc] initWithObjects:first, second, nil];
+	}
+
+	return self;
+}
+
+@end
+
+
+/// Pairs a value with the index of the left element it came from so results can be put back into the order of the left side.
+@interface CBHJoinIndexed : NSObject
+{
+	@package
+	NSUInteger _index;
+	id _value;
+}
+
+- (instancetype)initWithIndex:(NSUInteger)index value:(id)value;
+
+@end
+
+
+@implementation CBHJoinIndexed
+
+- (instancetype)initWithIndex:(NSUInteger)index value:(id)value
+{
+	if ( (self = [super init]) )
+	{
+		_index = index;
+		_value = value;
+	}
+
+	return self;
+}
+
+@end
+
+
+#pragma mark - Building
+
+/// Keys are retained rather than copied, so they only need to implement `isEqual:` and `hash`.
+static NSMapTable *CBHJoinTable(id<NSFastEnumeration> collection, NSUInteger count, id (^key)(id object))
+{
+	NSMapTable *table = [[NSMapTable alloc] initWithKeyOptions:NSPointerFunctionsStrongMemory valueOptions:NSPointerFunctionsStrongMemory capacity:( count != NSNotFound ) ? count : 0];
+
+	for (id object in collection)
+	{
+		id objectKey = key(object);
+		if ( !objectKey ) { continue; }
+
+		id entry = [table objectForKey:objectKey];
+
+		if ( !entry )
+		{
+			[table setObject:object forKey:objectKey];
+		}
+		else if ( [entry isKindOfClass:[CBHJoinBucket class]] )
+		{
+			[((CBHJoinBucket *)entry)->_elements addObject:object];
+		}
+		else
+		{
+			[table setObject:[[CBHJoinBucket alloc] initWithElement:entry element:object] forKey:objectKey];
+		}
+	}
+
+	return table;
+}
+
+static void CBHJoinEnumerateMatches(id entry, void (^block)(id match))
+{
+	if ( !entry ) { return; }
+
+	if ( ![entry isKindOfClass:[CBHJoinBucket class]] )
+	{
+		block(entry);
+		return;
+	}
+
+	for (id match in ((CBHJoinBucket *)entry)->_elements)
+	{
+		block(match);
+	}
+}
+
+
+#pragma mark - Probing
+
+static NSArray *CBHJoinArray(id<NSFastEnumeration> collection)
+{
+	id object = collection;
+
+	if ( [object isKindOfClass:[NSArray class]] ) { return object; }
+	if ( [object isKindOfClass:[NSOrderedSet class]] ) { return [(NSOrderedSet *)object array]; }
+	if ( [object isKindOfClass:[NSSet class]] ) { return [(NSSet *)object allObjects]; }
+	if ( [object isKindOfClass:[NSEnumerator class]] ) { return [(NSEnumerator *)object allObjects]; }
+
+	NSMutableArray *array = [NSMutableArray array];
+	for (id element in collection) { [array addObject:element]; }
+
+	return array;
+}
+
+static NSMutableArray *CBHJoinProbeSerially(id<NSFastEnumeration> collection, NSUInteger count, CBHJoinProbe probe)
+{
+	NSMutableArray *result = [[NSMutableArray alloc] initWithCapacity:( count != NSNotFound ) ? count : 0];
+
+	for (id object in collection)
+	{
+		probe(object, result);
+	}
+
+	return result;
+}
+
+static NSMutableArray *CBHJoinProbeConcurrently(NSArray *collection, CBHJoinProbe probe, CBHMapReduceExecutor *executor)
+{
+	NSUInteger count = [collection count];
+	NSMutableDictionary<NSNumber *, NSMutableArray *> *partitions = [NSMutableDictionary dictionary];
+
+	/// The table is fully built before probing starts so it is only ever read from the workers.
+	[executor applyRangesOfCount:count block:^(NSRange range) {
+		NSMutableArray *into = [[NSMutableArray alloc] initWithCapacity:range.length];
+
+		for (NSUInteger i = range.location; i < NSMaxRange(range); ++i)
+		{
+			probe([collection objectAtIndex:i], into);
+		}
+
+		@synchronized (partitions)
+		{
+			[partitions setObject:into forKey:@(range.location)];
+		}
+	}];
+
+	NSArray<NSNumber *> *locations = [[partitions allKeys] sortedArrayUsingSelector:@selector(compare:)];
+	NSUInteger total = 0;
+
+	for (NSNumber *location in locations) { total += [[partitions objectForKey:location] count]; }
+
+	NSMutableArray *result = [[NSMutableArray alloc] initWithCapacity:total];
+	for (NSNumber *location in locations) { [result addObjectsFromArray:[partitions objectForKey:location]]; }
+
+	return result;
+}
+
+static NSMutableArray *CBHJoinProbeSide(id<NSFastEnumeration> collection, NSUInteger count, CBHJoinProbe probe, CBHMapReduceExecutor *executor)
+{
+	if ( executor ) { return CBHJoinProbeConcurrently(CBHJoinArray(collection), probe, executor); }
+	return CBHJoinProbeSerially(collection, count, probe);
+}
+
+
+#pragma mark - Ordering
+
+static NSArray *CBHJoinIndexedArray(id<NSFastEnumeration> collection, NSUInteger count)
+{
+	NSMutableArray *indexed = [[NSMutableArray alloc] initWithCapacity:count];
+	NSUInteger index = 0;
+
+	for (id object in collection)
+	{
+		[indexed addObject:[[CBHJoinIndexed alloc] initWithIndex:index++ value:object]];
+	}
+
+	return indexed;
+}
+
+static NSMutableArray *CBHJoinRestoreLeftOrder(NSMutableArray *indexed)
+{
+	/// The sort is stable so the matches of each left element stay in the order of the right side.
+	[indexed sortWithOptions:NSSortStable usingComparator:^NSComparisonResult(CBHJoinIndexed *lhs, CBHJoinIndexed *rhs) {
+		if ( lhs->_index < rhs->_index ) { return NSOrderedAscending; }
+		if ( lhs->_index > rhs->_index ) { return NSOrderedDescending; }
+		return NSOrderedSame;
+	}];
+
+	NSMutableArray *result = [[NSMutableArray alloc] initWithCapacity:[indexed count]];
+
+	for (CBHJoinIndexed *entry in indexed)
+	{
+		if ( entry->_value ) { [result addObject:entry->_value]; }
+	}
+
+	return result;
+}
+
+static NSMutableArray *CBHJoinCollectLeft(CBHJoinKind kind, NSArray<CBHJoinIndexed *> *indexed, NSMutableArray<CBHJoinIndexed *> *matches, id (^combine)(id leftElement, id rightElement))
+{
+	if ( kind == CBHJoinKindInner ) { return CBHJoinRestoreLeftOrder(matches); }
+
+	NSMutableData *flags = [[NSMutableData alloc] initWithLength:[indexed count]];
+	uint8_t *isMatched = (uint8_t *)[flags mutableBytes];
+
+	for (CBHJoinIndexed *match in matches) { isMatched[match->_index] = 1; }
+
+	if ( kind == CBHJoinKindLeftOuter )
+	{
+		for (CBHJoinIndexed *entry in indexed)
+		{
+			if ( isMatched[entry->_index] ) { continue; }
+			[matches addObject:[[CBHJoinIndexed alloc] initWithIndex:entry->_index value:combine(entry->_value, nil)]];
+		}
+
+		return CBHJoinRestoreLeftOrder(matches);
+	}
+
+	/// Semi and anti joins return each left element at most once, however many right elements it matched.
+	BOOL isKeptWhenMatched = ( kind == CBHJoinKindSemi );
+	NSMutableArray *result = [[NSMutableArray alloc] initWithCapacity:[indexed count]];
+
+	for (CBHJoinIndexed *entry in indexed)
+	{
+		if ( (isMatched[entry->_index] != 0) == isKeptWhenMatched ) { [result addObject:entry->_value]; }
+	}
+
+	return result;
+}
+
+
+#pragma mark - Joining
+
+NSUInteger CBHJoinCount(id<NSFastEnumeration> collection)
+{
+	id object = collection;
+	if ( ![object respondsToSelector:@selector(count)] ) { return NSNotFound; }
+
+	return [object count];
+}
+
+NSMutableArray *CBHJoin(CBHJoinKind kind, id<NSFastEnumeration> left, NSUInteger leftCount, id<NSFastEnumeration> right, NSUInteger rightCount, id (^leftKey)(id object), id (^rightKey)(id object), id (^combine)(id leftElement, id rightElement), CBHMapReduceExecutor *executor)
+{
+	BOOL buildLeft = ( leftCount != NSNotFound && (rightCount == NSNotFound || leftCount < rightCount) );
+
+	if ( buildLeft )
+	{
+		/// Each match carries the index of its left element, so the results can be put in the order of the left side and the left
+		/// elements without a match can be found. Matches are kept even when `combine` returns `nil` for the same reason.
+		NSArray *indexed = CBHJoinIndexedArray(left, leftCount);
+		NSMapTable *table = CBHJoinTable(indexed, leftCount, ^id (CBHJoinIndexed *entry) {
+			return leftKey(entry->_value);
+		});
+		BOOL isCombined = ( kind == CBHJoinKindInner || kind == CBHJoinKindLeftOuter );
+
+		CBHJoinProbe probe = ^(id element, NSMutableArray *into) {
+			id elementKey = rightKey(element);
+			if ( !elementKey ) { return; }
+
+			CBHJoinEnumerateMatches([table objectForKey:elementKey], ^(CBHJoinIndexed *match) {
+				id combined = ( isCombined ) ? combine(match->_value, element) : nil;
+				[into addObject:[[CBHJoinIndexed alloc] initWithIndex:match->_index value:combined]];
+			});
+		};
+
+		return CBHJoinCollectLeft(kind, indexed, CBHJoinProbeSide(right, rightCount, probe, executor), combine);
+	}
+
+	NSMapTable *table = CBHJoinTable(right, rightCount, rightKey);
+	CBHJoinProbe probe = nil;
+
+	switch ( kind )
+	{
+		case CBHJoinKindInner:
+		{
+			probe = ^(id element, NSMutableArray *into) {
+				id elementKey = leftKey(element);
+				if ( !elementKey ) { return; }
+
+				CBHJoinEnumerateMatches([table objectForKey:elementKey], ^(id match) {
+					id combined = combine(element, match);
+					if ( combined ) { [into addObject:combined]; }
+				});
+			};
+		} break;
+
+		case CBHJoinKindLeftOuter:
+		{
+			probe = ^(id element, NSMutableArray *into) {
+				id elementKey = leftKey(element);
+				id entry = ( elementKey ) ? [table objectForKey:elementKey] : nil;
+
+				if ( !entry )
+				{
+					id combined = combine(element, nil);
+					if ( combined ) { [into addObject:combined]; }
+					return;
+				}
+
+				CBHJoinEnumerateMatches(entry, ^(id match) {
+					id combined = combine(element, match);
+					if ( combined ) { [into addObject:combined]; }
+				});
+			};
+		} break;
+
+		case CBHJoinKindSemi:
+		{
+			probe = ^(id element, NSMutableArray *into) {
+				id elementKey = leftKey(element);
+				if ( elementKey && [table objectForKey:elementKey] ) { [into addObject:element]; }
+			};
+		} break;
+
+		case CBHJoinKindAnti:
+		{
+			probe = ^(id element, NSMutableArray *into) {
+				id elementKey = leftKey(element);
+				if ( !elementKey || ![table objectForKey:elementKey] ) { [into addObject:element]; }
+			};
+		} break;
+	}
+
+	return CBHJoinProbeSide(left, leftCount, probe, executor);
+}
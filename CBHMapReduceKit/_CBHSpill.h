@@ -0,0 +1,107 @@
+//  _CBHSpill.h
+//  CBHMapReduceKit
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+@import Foundation;
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+/** Returns an estimate of the memory used by an object and the storage of its contents.
+ *
+ * Collections are charged a word for each reference they hold, and data and strings for their length, since mutable ones keep their
+ * contents outside of the object. The objects a collection references are not included. Objects that are not allocated on the heap,
+ * such as tagged pointers, are estimated by their contents alone.
+ */
+NSUInteger CBHSpillEstimateSize(id _Nullable object);
+
+/** Returns the partition that the records of a key are written to.
+ *
+ * @param key               The key of a record.
+ * @param partitionCount    The number of partitions of the spill.
+ *
+ * @return                  The index of the partition.
+ */
+NSUInteger CBHSpillPartitionOfKey(id key, NSUInteger partitionCount);
+
+
+/** A set of temporary files holding key-value records, hash partitioned by key.
+ *
+ * Records are encoded with a compact tagged binary encoding. Property-list objects and `NSNull` are encoded directly, and any other
+ * object is archived if it conforms to `NSCoding`. Decoded arrays and dictionaries are mutable. The files are removed when the spill
+ * is deallocated.
+ */
+@interface CBHSpill : NSObject
+
+#pragma mark - Initialization
+
+/** Creates the temporary files of a spill.
+ *
+ * @param partitionCount    The number of partitions to hash records into.
+ * @param error             On failure, the reason the files could not be created.
+ *
+ * @return                  The initialized spill, or `nil` on failure.
+ */
+- (nullable instancetype)initWithPartitionCount:(NSUInteger)partitionCount error:(NSError **)error;
+
+- (instancetype)init NS_UNAVAILABLE;
++ (instancetype)new NS_UNAVAILABLE;
+
+
+#pragma mark - Properties
+
+/// The number of partitions records are hashed into.
+@property (nonatomic, readonly) NSUInteger partitionCount;
+
+
+#pragma mark - Writing
+
+/** Appends a record to the partition of its key.
+ *
+ * @param key       The key of the record.
+ * @param value     The value of the record.
+ * @param isSeed    Whether the value is an accumulated value rather than an element.
+ * @param error     On failure, the reason the record could not be written.
+ *
+ * @return          Whether the record was written.
+ */
+- (BOOL)writeKey:(id)key value:(id)value seed:(BOOL)isSeed error:(NSError **)error;
+
+/** Flushes and closes the partitions so that they can be read.
+ *
+ * @param error     On failure, the reason the partitions could not be flushed.
+ *
+ * @return          Whether the partitions were flushed.
+ */
+- (BOOL)finishWritingWithError:(NSError **)error;
+
+
+#pragma mark - Reading
+
+/** Reads the records of a partition in the order they were written.
+ *
+ * @param partition     The index of the partition to read.
+ * @param error         On failure, the reason the partition could not be read.
+ * @param block         A closure called with each record.
+ *
+ * @return              Whether the whole partition was read.
+ */
+- (BOOL)enumeratePartition:(NSUInteger)partition error:(NSError **)error usingBlock:(void (NS_NOESCAPE ^)(id key, id value, BOOL isSeed))block;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,543 @@
+//  _CBHSpill.m
+//  CBHMapReduceKit
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+#import "_CBHSpill.h"
+
+#import "CBHMapReduceError.h"
+
+#import <errno.h>
+#import <malloc/malloc.h>
+#import <stdio.h>
+
+
+/// Each partition is written through its own buffer so appending a record rarely touches the disk.
+static const size_t CBHSpillBufferSize = 64 * 1024;
+
+typedef NS_ENUM(uint8_t, CBHSpillTag)
+{
+	CBHSpillTagNull,
+	CBHSpillTagFalse,
+	CBHSpillTagTrue,
+	CBHSpillTagInteger,
+	CBHSpillTagUnsigned,
+	CBHSpillTagDouble,
+	CBHSpillTagString,
+	CBHSpillTagData,
+	CBHSpillTagDate,
+	CBHSpillTagArray,
+	CBHSpillTagDictionary,
+	CBHSpillTagArchive,
+};
+
+
+NSUInteger CBHSpillEstimateSize(id object)
+{
+	if ( !object ) { return 0; }
+
+	NSUInteger size = malloc_size((__bridge const void *)object);
+
+	if ( [object isKindOfClass:[NSData class]] ) { return size + [(NSData *)object length]; }
+	if ( [object isKindOfClass:[NSString class]] ) { return size + [(NSString *)object length] * sizeof(unichar); }
+	if ( [object isKindOfClass:[NSDictionary class]] ) { return size + [(NSDictionary *)object count] * 2 * sizeof(id); }
+	if ( [object isKindOfClass:[NSArray class]] ) { return size + [(NSArray *)object count] * sizeof(id); }
+	if ( [object isKindOfClass:[NSSet class]] ) { return size + [(NSSet *)object count] * sizeof(id); }
+	if ( [object isKindOfClass:[NSOrderedSet class]] ) { return size + [(NSOrderedSet *)object count] * 2 * sizeof(id); }
+
+	return size;
+}
+
+NSUInteger CBHSpillPartitionOfKey(id key, NSUInteger partitionCount)
+{
+	return [key hash] % partitionCount;
+}
+
+
+#pragma mark - Errors
+
+static void CBHSpillSetError(NSError **error, CBHMapReduceErrorCode code, NSError *underlyingError, NSString *description)
+{
+	if ( !error ) { return; }
+
+	NSMutableDictionary *userInfo = [[NSMutableDictionary alloc] initWithCapacity:2];
+	[userInfo setObject:description forKey:NSLocalizedDescriptionKey];
+	if ( underlyingError ) { [userInfo setObject:underlyingError forKey:NSUnderlyingErrorKey]; }
+
+	*error = [NSError errorWithDomain:CBHMapReduceErrorDomain code:code userInfo:userInfo];
+}
+
+static void CBHSpillSetPOSIXError(NSError **error, int code, NSString *description)
+{
+	NSError *underlyingError = [NSError errorWithDomain:NSPOSIXErrorDomain code:code userInfo:nil];
+	CBHSpillSetError(error, CBHMapReduceErrorSpillFailed, underlyingError, description);
+}
+
+
+#pragma mark - Encoding
+
+static void CBHSpillAppendTag(NSMutableData *buffer, CBHSpillTag tag)
+{
+	[buffer appendBytes:&tag length:sizeof(tag)];
+}
+
+static void CBHSpillAppendVarint(NSMutableData *buffer, uint64_t value)
+{
+	uint8_t bytes[10];
+	NSUInteger length = 0;
+
+	do
+	{
+		uint8_t byte = value & 0x7f;
+		value >>= 7;
+		if ( value ) { byte |= 0x80; }
+
+		bytes[length++] = byte;
+	}
+	while ( value );
+
+	[buffer appendBytes:bytes length:length];
+}
+
+static void CBHSpillAppendDouble(NSMutableData *buffer, double value)
+{
+	[buffer appendBytes:&value length:sizeof(value)];
+}
+
+static BOOL CBHSpillEncode(NSMutableData *buffer, id object)
+{
+	if ( object == [NSNull null] )
+	{
+		CBHSpillAppendTag(buffer, CBHSpillTagNull);
+		return YES;
+	}
+
+	if ( [object isKindOfClass:[NSNumber class]] && ![object isKindOfClass:[NSDecimalNumber class]] )
+	{
+		NSNumber *number = object;
+
+		if ( (__bridge CFBooleanRef)number == kCFBooleanTrue || (__bridge CFBooleanRef)number == kCFBooleanFalse )
+		{
+			CBHSpillAppendTag(buffer, ( [number boolValue] ) ? CBHSpillTagTrue : CBHSpillTagFalse);
+		}
+		else if ( CFNumberIsFloatType((__bridge CFNumberRef)number) )
+		{
+			CBHSpillAppendTag(buffer, CBHSpillTagDouble);
+			CBHSpillAppendDouble(buffer, [number doubleValue]);
+		}
+		else if ( strcmp([number objCType], @encode(unsigned long long)) == 0 && [number unsignedLongLongValue] > INT64_MAX )
+		{
+			CBHSpillAppendTag(buffer, CBHSpillTagUnsigned);
+			CBHSpillAppendVarint(buffer, [number unsignedLongLongValue]);
+		}
+		else
+		{
+			/// Zigzag encoding keeps small negative numbers short.
+			int64_t value = [number longLongValue];
+			CBHSpillAppendTag(buffer, CBHSpillTagInteger);
+			CBHSpillAppendVarint(buffer, ((uint64_t)value << 1) ^ (uint64_t)(value >> 63));
+		}
+
+		return YES;
+	}
+
+	if ( [object isKindOfClass:[NSString class]] )
+	{
+		NSString *string = object;
+		NSUInteger length = [string lengthOfBytesUsingEncoding:NSUTF8StringEncoding];
+
+		CBHSpillAppendTag(buffer, CBHSpillTagString);
+		CBHSpillAppendVarint(buffer, length);
+
+		NSUInteger offset = [buffer length];
+		[buffer increaseLengthBy:length];
+		[string getBytes:(uint8_t *)[buffer mutableBytes] + offset maxLength:length usedLength:NULL encoding:NSUTF8StringEncoding options:0 range:NSMakeRange(0, [string length]) remainingRange:NULL];
+
+		return YES;
+	}
+
+	if ( [object isKindOfClass:[NSData class]] )
+	{
+		CBHSpillAppendTag(buffer, CBHSpillTagData);
+		CBHSpillAppendVarint(buffer, [(NSData *)object length]);
+		[buffer appendData:object];
+		return YES;
+	}
+
+	if ( [object isKindOfClass:[NSDate class]] )
+	{
+		CBHSpillAppendTag(buffer, CBHSpillTagDate);
+		CBHSpillAppendDouble(buffer, [(NSDate *)object timeIntervalSinceReferenceDate]);
+		return YES;
+	}
+
+	if ( [object isKindOfClass:[NSArray class]] )
+	{
+		CBHSpillAppendTag(buffer, CBHSpillTagArray);
+		CBHSpillAppendVarint(buffer, [(NSArray *)object count]);
+
+		for (id element in (NSArray *)object)
+		{
+			if ( !CBHSpillEncode(buffer, element) ) { return NO; }
+		}
+
+		return YES;
+	}
+
+	if ( [object isKindOfClass:[NSDictionary class]] )
+	{
+		NSDictionary *dictionary = object;
+
+		CBHSpillAppendTag(buffer, CBHSpillTagDictionary);
+		CBHSpillAppendVarint(buffer, [dictionary count]);
+
+		for (id key in dictionary)
+		{
+			if ( !CBHSpillEncode(buffer, key) ) { return NO; }
+			if ( !CBHSpillEncode(buffer, [dictionary objectForKey:key]) ) { return NO; }
+		}
+
+		return YES;
+	}
+
+	if ( [object conformsToProtocol:@protocol(NSCoding)] )
+	{
+		NSData *archive = [NSKeyedArchiver archivedDataWithRootObject:object];
+
+		CBHSpillAppendTag(buffer, CBHSpillTagArchive);
+		CBHSpillAppendVarint(buffer, [archive length]);
+		[buffer appendData:archive];
+
+		return YES;
+	}
+
+	return NO;
+}
+
+
+#pragma mark - Decoding
+
+static BOOL CBHSpillReadVarint(const uint8_t **cursor, const uint8_t *end, uint64_t *value)
+{
+	uint64_t result = 0;
+
+	for (unsigned shift = 0; shift < 64; shift += 7)
+	{
+		if ( *cursor >= end ) { return NO; }
+
+		uint8_t byte = *(*cursor)++;
+		result |= (uint64_t)(byte & 0x7f) << shift;
+
+		if ( !(byte & 0x80) )
+		{
+			*value = result;
+			return YES;
+		}
+	}
+
+	return NO;
+}
+
+static BOOL CBHSpillReadDouble(const uint8_t **cursor, const uint8_t *end, double *value)
+{
+	if ( (size_t)(end - *cursor) < sizeof(double) ) { return NO; }
+
+	memcpy(value, *cursor, sizeof(double));
+	*cursor += sizeof(double);
+
+	return YES;
+}
+
+static BOOL CBHSpillReadLength(const uint8_t **cursor, const uint8_t *end, NSUInteger *length)
+{
+	uint64_t value = 0;
+	if ( !CBHSpillReadVarint(cursor, end, &value) ) { return NO; }
+	if ( value > (uint64_t)(end - *cursor) ) { return NO; }
+
+	*length = (NSUInteger)value;
+	return YES;
+}
+
+/// Returns the next object, or `nil` if the encoding is malformed.
+static id CBHSpillDecode(const uint8_t **cursor, const uint8_t *end)
+{
+	if ( *cursor >= end ) { return nil; }
+
+	CBHSpillTag tag = *(*cursor)++;
+	uint64_t integer = 0;
+	double real = 0;
+	NSUInteger length = 0;
+
+	switch ( tag )
+	{
+		case CBHSpillTagNull:
+			return [NSNull null];
+
+		case CBHSpillTagFalse:
+			return @NO;
+
+		case CBHSpillTagTrue:
+			return @YES;
+
+		case CBHSpillTagInteger:
+			if ( !CBHSpillReadVarint(cursor, end, &integer) ) { return nil; }
+			return @((int64_t)(integer >> 1) ^ -(int64_t)(integer & 1));
+
+		case CBHSpillTagUnsigned:
+			if ( !CBHSpillReadVarint(cursor, end, &integer) ) { return nil; }
+			return @(integer);
+
+		case CBHSpillTagDouble:
+			if ( !CBHSpillReadDouble(cursor, end, &real) ) { return nil; }
+			return @(real);
+
+		case CBHSpillTagString:
+		{
+			if ( !CBHSpillReadLength(cursor, end, &length) ) { return nil; }
+
+			NSString *string = [[NSString alloc] initWithBytes:*cursor length:length encoding:NSUTF8StringEncoding];
+			*cursor += length;
+
+			return string;
+		}
+
+		case CBHSpillTagData:
+		{
+			if ( !CBHSpillReadLength(cursor, end, &length) ) { return nil; }
+
+			NSData *data = [[NSData alloc] initWithBytes:*cursor length:length];
+			*cursor += length;
+
+			return data;
+		}
+
+		case CBHSpillTagDate:
+			if ( !CBHSpillReadDouble(cursor, end, &real) ) { return nil; }
+			return [[NSDate alloc] initWithTimeIntervalSinceReferenceDate:real];
+
+		case CBHSpillTagArray:
+		{
+			if ( !CBHSpillReadVarint(cursor, end, &integer) ) { return nil; }
+
+			/// Every element takes at least a byte, which bounds the capacity of a malformed count.
+			NSMutableArray *array = [[NSMutableArray alloc] initWithCapacity:(NSUInteger)MIN(integer, (uint64_t)(end - *cursor))];
+
+			for (uint64_t i = 0; i < integer; ++i)
+			{
+				id element = CBHSpillDecode(cursor, end);
+				if ( !element ) { return nil; }
+
+				[array addObject:element];
+			}
+
+			return array;
+		}
+
+		case CBHSpillTagDictionary:
+		{
+			if ( !CBHSpillReadVarint(cursor, end, &integer) ) { return nil; }
+
+			NSMutableDictionary *dictionary = [[NSMutableDictionary alloc] initWithCapacity:(NSUInteger)MIN(integer, (uint64_t)(end - *cursor))];
+
+			for (uint64_t i = 0; i < integer; ++i)
+			{
+				id key = CBHSpillDecode(cursor, end);
+				id value = ( key ) ? CBHSpillDecode(cursor, end) : nil;
+				if ( !value ) { return nil; }
+
+				[dictionary setObject:value forKey:key];
+			}
+
+			return dictionary;
+		}
+
+		case CBHSpillTagArchive:
+		{
+			if ( !CBHSpillReadLength(cursor, end, &length) ) { return nil; }
+
+			NSData *archive = [[NSData alloc] initWithBytesNoCopy:(void *)*cursor length:length freeWhenDone:NO];
+			*cursor += length;
+
+			return [NSKeyedUnarchiver unarchiveObjectWithData:archive];
+		}
+	}
+
+	return nil;
+}
+
+
+@implementation CBHSpill
+{
+	NSString *_directory;
+	NSMutableArray<NSString *> *_paths;
+	FILE **_files;
+
+	NSMutableData *_record;
+}
+
+
+#pragma mark - Initialization
+
+- (instancetype)initWithPartitionCount:(NSUInteger)partitionCount error:(NSError **)error
+{
+	if ( (self = [super init]) )
+	{
+		_partitionCount = partitionCount;
+		_paths = [[NSMutableArray alloc] initWithCapacity:partitionCount];
+		_files = (FILE **)calloc(partitionCount, sizeof(FILE *));
+		_record = [[NSMutableData alloc] init];
+
+		NSString *template = [NSTemporaryDirectory() stringByAppendingPathComponent:@"CBHMapReduceKit.XXXXXX"];
+		char *directory = strdup([template fileSystemRepresentation]);
+
+		if ( !mkdtemp(directory) )
+		{
+			CBHSpillSetPOSIXError(error, errno, @"The spill directory could not be created.");
+			free(directory);
+			return nil;
+		}
+
+		_directory = [[NSFileManager defaultManager] stringWithFileSystemRepresentation:directory length:strlen(directory)];
+		free(directory);
+
+		for (NSUInteger partition = 0; partition < partitionCount; ++partition)
+		{
+			NSString *path = [_directory stringByAppendingPathComponent:[NSString stringWithFormat:@"%lu", (unsigned long)partition]];
+			FILE *file = fopen([path fileSystemRepresentation], "wb");
+
+			if ( !file )
+			{
+				CBHSpillSetPOSIXError(error, errno, @"A spill partition could not be created.");
+				return nil;
+			}
+
+			setvbuf(file, NULL, _IOFBF, CBHSpillBufferSize);
+
+			_files[partition] = file;
+			[_paths addObject:path];
+		}
+	}
+
+	return self;
+}
+
+- (void)dealloc
+{
+	if ( _files )
+	{
+		for (NSUInteger partition = 0; partition < _partitionCount; ++partition)
+		{
+			if ( _files[partition] ) { fclose(_files[partition]); }
+		}
+
+		free(_files);
+	}
+
+	if ( _directory ) { [[NSFileManager defaultManager] removeItemAtPath:_directory error:NULL]; }
+}
+
+
+#pragma mark - Writing
+
+- (BOOL)writeKey:(id)key value:(id)value seed:(BOOL)isSeed error:(NSError **)error
+{
+	uint8_t kind = ( isSeed ) ? 1 : 0;
+
+	[_record setLength:0];
+	[_record appendBytes:&kind length:sizeof(kind)];
+
+	if ( !CBHSpillEncode(_record, key) || !CBHSpillEncode(_record, value) )
+	{
+		CBHSpillSetError(error, CBHMapReduceErrorUnencodableObject, nil, @"A key or value could not be encoded to be spilled.");
+		return NO;
+	}
+
+	FILE *file = _files[CBHSpillPartitionOfKey(key, _partitionCount)];
+
+	if ( fwrite([_record bytes], 1, [_record length], file) != [_record length] )
+	{
+		CBHSpillSetPOSIXError(error, errno, @"A spill partition could not be written.");
+		return NO;
+	}
+
+	return YES;
+}
+
+- (BOOL)finishWritingWithError:(NSError **)error
+{
+	BOOL isFinished = YES;
+
+	for (NSUInteger partition = 0; partition < _partitionCount; ++partition)
+	{
+		if ( !_files[partition] ) { continue; }
+
+		if ( fclose(_files[partition]) != 0 && isFinished )
+		{
+			CBHSpillSetPOSIXError(error, errno, @"A spill partition could not be flushed.");
+			isFinished = NO;
+		}
+
+		_files[partition] = NULL;
+	}
+
+	return isFinished;
+}
+
+
+#pragma mark - Reading
+
+- (BOOL)enumeratePartition:(NSUInteger)partition error:(NSError **)error usingBlock:(void (NS_NOESCAPE ^)(id key, id value, BOOL isSeed))block
+{
+	NSError *readError = nil;
+	NSData *data = [[NSData alloc] initWithContentsOfFile:[_paths objectAtIndex:partition] options:NSDataReadingMappedIfSafe error:&readError];
+
+	if ( !data )
+	{
+		CBHSpillSetError(error, CBHMapReduceErrorSpillFailed, readError, @"A spill partition could not be read.");
+		return NO;
+	}
+
+	const uint8_t *cursor = [data bytes];
+	const uint8_t *end = cursor + [data length];
+
+	while ( cursor < end )
+	{
+		BOOL isDecoded = NO;
+
+		@autoreleasepool
+		{
+			BOOL isSeed = ( *cursor++ != 0 );
+			id key = CBHSpillDecode(&cursor, end);
+			id value = ( key ) ? CBHSpillDecode(&cursor, end) : nil;
+
+			if ( value )
+			{
+				block(key, value, isSeed);
+				isDecoded = YES;
+			}
+		}
+
+		if ( !isDecoded )
+		{
+			CBHSpillSetPOSIXError(error, EILSEQ, @"A spill partition is malformed.");
+			return NO;
+		}
+	}
+
+	return YES;
+}
+
+@end
@@ -0,0 +1,90 @@
+//  _CBHViewIndexes.h
+//  CBHMapReduceKit
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+@import Foundation;
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+/** The indexes of a source that are included in a view, kept as a tree of fixed size chunks so that they can be shifted and ranked in
+ * logarithmic time.
+ *
+ * Each chunk holds up to 64 consecutive indexes of the source as a bit mask of which are included. Chunks are nodes of a treap ordered
+ * by position, each carrying the number of indexes and of included indexes beneath it, so that an index is found and its position
+ * in the view counted in one descent. Inserting or removing an index shifts only the bits of its own chunk.
+ */
+@interface CBHViewIndexes : NSObject
+
+#pragma mark - Properties
+
+/// The number of indexes in the source, whether included or not.
+@property (nonatomic, readonly) NSUInteger count;
+
+
+#pragma mark - Querying
+
+/** Returns whether an index of the source is included in the view.
+ *
+ * @param index     An index of the source less than `count`.
+ *
+ * @return          Whether the index is included.
+ */
+- (BOOL)containsIndex:(NSUInteger)index;
+
+/** Returns the number of included indexes before an index of the source, which is the position of its element in the view or where
+ * it would be inserted.
+ *
+ * @param index     An index of the source no greater than `count`.
+ *
+ * @return          The position in the view.
+ */
+- (NSUInteger)positionOfIndex:(NSUInteger)index;
+
+
+#pragma mark - Mutating
+
+/** Inserts an index into the source, shifting those at and after it up by one.
+ *
+ * @param index         The index to insert, no greater than `count`.
+ * @param isIncluded    Whether the inserted index is included in the view.
+ */
+- (void)insertIndex:(NSUInteger)index included:(BOOL)isIncluded;
+
+/** Removes an index from the source, shifting those after it down by one.
+ *
+ * @param index     The index to remove, less than `count`.
+ */
+- (void)removeIndex:(NSUInteger)index;
+
+/** Sets whether an index of the source is included in the view.
+ *
+ * @param isIncluded    Whether the index is included.
+ * @param index         An index of the source less than `count`.
+ */
+- (void)setIncluded:(BOOL)isIncluded atIndex:(NSUInteger)index;
+
+/** Replaces every index with those of a source of the given length.
+ *
+ * @param count     The number of indexes in the source.
+ * @param indexes   The indexes that are included in the view, all less than `count`.
+ */
+- (void)resetWithCount:(NSUInteger)count includedIndexes:(NSIndexSet *)indexes;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,356 @@
+//  _CBHViewIndexes.m
+//  CBHMapReduceKit
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+#import "_CBHViewIndexes.h"
+
+#import <stdlib.h>
+
+
+/// The number of indexes a chunk can hold, one for each bit of its mask.
+#define CBHChunkCapacity 64
+
+/// The number of indexes chunks hold after a reset, which leaves room to insert into each before it must be split.
+#define CBHChunkFill 32
+
+
+#pragma mark - Chunks
+
+typedef struct CBHChunk
+{
+	struct CBHChunk *left;
+	struct CBHChunk *right;
+	uint32_t priority;
+
+	uint64_t mask;
+	NSUInteger length;
+
+	/// The number of indexes, and of included indexes, in this chunk and every chunk beneath it.
+	NSUInteger total;
+	NSUInteger included;
+} CBHChunk;
+
+typedef NS_ENUM(uint8_t, CBHChunkOperation)
+{
+	CBHChunkOperationInsertExcluded,
+	CBHChunkOperationInsertIncluded,
+	CBHChunkOperationRemove,
+	CBHChunkOperationExclude,
+	CBHChunkOperationInclude,
+};
+
+static inline NSUInteger CBHChunkTotal(const CBHChunk *chunk)
+{
+	return ( chunk ) ? chunk->total : 0;
+}
+
+static inline NSUInteger CBHChunkIncluded(const CBHChunk *chunk)
+{
+	return ( chunk ) ? chunk->included : 0;
+}
+
+static void CBHChunkUpdate(CBHChunk *chunk)
+{
+	chunk->total = CBHChunkTotal(chunk->left) + chunk->length + CBHChunkTotal(chunk->right);
+	chunk->included = CBHChunkIncluded(chunk->left) + (NSUInteger)__builtin_popcountll(chunk->mask) + CBHChunkIncluded(chunk->right);
+}
+
+static CBHChunk *CBHChunkCreate(uint64_t mask, NSUInteger length)
+{
+	CBHChunk *chunk = (CBHChunk *)calloc(1, sizeof(CBHChunk));
+	chunk->priority = arc4random();
+	chunk->mask = mask;
+	chunk->length = length;
+
+	CBHChunkUpdate(chunk);
+
+	return chunk;
+}
+
+static void CBHChunkFree(CBHChunk *chunk)
+{
+	if ( !chunk ) { return; }
+
+	CBHChunkFree(chunk->left);
+	CBHChunkFree(chunk->right);
+	free(chunk);
+}
+
+
+#pragma mark - Restructuring
+
+/// Joins two trees, every index of `left` coming before those of `right`.
+static CBHChunk *CBHChunkMerge(CBHChunk *left, CBHChunk *right)
+{
+	if ( !left ) { return right; }
+	if ( !right ) { return left; }
+
+	if ( left->priority > right->priority )
+	{
+		left->right = CBHChunkMerge(left->right, right);
+		CBHChunkUpdate(left);
+		return left;
+	}
+
+	right->left = CBHChunkMerge(left, right->left);
+	CBHChunkUpdate(right);
+	return right;
+}
+
+/// Splits a tree into the chunks holding its first `count` indexes and the rest. `count` must fall between two chunks.
+static void CBHChunkSplit(CBHChunk *chunk, NSUInteger count, CBHChunk **left, CBHChunk **right)
+{
+	if ( !chunk )
+	{
+		*left = NULL;
+		*right = NULL;
+		return;
+	}
+
+	NSUInteger leftTotal = CBHChunkTotal(chunk->left);
+
+	if ( count <= leftTotal )
+	{
+		CBHChunkSplit(chunk->left, count, left, &chunk->left);
+		*right = chunk;
+	}
+	else
+	{
+		CBHChunkSplit(chunk->right, count - leftTotal - chunk->length, &chunk->right, right);
+		*left = chunk;
+	}
+
+	CBHChunkUpdate(chunk);
+}
+
+
+#pragma mark - Finding
+
+/// Returns the chunk holding `index`, or for an insertion the chunk it would be appended to, and the offset of the index within it.
+static CBHChunk *CBHChunkFind(CBHChunk *chunk, NSUInteger index, BOOL isInsertion, NSUInteger *offset)
+{
+	while ( chunk )
+	{
+		NSUInteger leftTotal = CBHChunkTotal(chunk->left);
+
+		if ( chunk->left && (index < leftTotal || (isInsertion && index == leftTotal)) )
+		{
+			chunk = chunk->left;
+			continue;
+		}
+
+		index -= leftTotal;
+
+		if ( index < chunk->length || (isInsertion && index == chunk->length) )
+		{
+			*offset = index;
+			return chunk;
+		}
+
+		index -= chunk->length;
+		chunk = chunk->right;
+	}
+
+	return NULL;
+}
+
+/// Applies an operation to the index, found as by `CBHChunkFind`, and refreshes the totals above it. A chunk left empty is removed.
+static CBHChunk *CBHChunkApply(CBHChunk *chunk, NSUInteger index, CBHChunkOperation operation)
+{
+	BOOL isInsertion = ( operation == CBHChunkOperationInsertExcluded || operation == CBHChunkOperationInsertIncluded );
+	NSUInteger leftTotal = CBHChunkTotal(chunk->left);
+
+	if ( chunk->left && (index < leftTotal || (isInsertion && index == leftTotal)) )
+	{
+		chunk->left = CBHChunkApply(chunk->left, index, operation);
+	}
+	else if ( index - leftTotal < chunk->length || (isInsertion && index - leftTotal == chunk->length) )
+	{
+		uint64_t bit = (uint64_t)1 << (index - leftTotal);
+		uint64_t below = chunk->mask & (bit - 1);
+
+		switch ( operation )
+		{
+			case CBHChunkOperationInsertExcluded:
+			case CBHChunkOperationInsertIncluded:
+				chunk->mask = below | ((chunk->mask & ~(bit - 1)) << 1) | (( operation == CBHChunkOperationInsertIncluded ) ? bit : 0);
+				chunk->length += 1;
+				break;
+
+			case CBHChunkOperationRemove:
+				chunk->mask = below | ((chunk->mask >> 1) & ~(bit - 1));
+				chunk->length -= 1;
+				break;
+
+			case CBHChunkOperationExclude:
+				chunk->mask &= ~bit;
+				break;
+
+			case CBHChunkOperationInclude:
+				chunk->mask |= bit;
+				break;
+		}
+
+		if ( chunk->length == 0 )
+		{
+			CBHChunk *merged = CBHChunkMerge(chunk->left, chunk->right);
+			free(chunk);
+			return merged;
+		}
+	}
+	else
+	{
+		chunk->right = CBHChunkApply(chunk->right, index - leftTotal - chunk->length, operation);
+	}
+
+	CBHChunkUpdate(chunk);
+	return chunk;
+}
+
+
+@implementation CBHViewIndexes
+{
+	CBHChunk *_root;
+}
+
+
+#pragma mark - Initialization
+
+- (void)dealloc
+{
+	CBHChunkFree(_root);
+}
+
+
+#pragma mark - Properties
+
+- (NSUInteger)count
+{
+	return CBHChunkTotal(_root);
+}
+
+
+#pragma mark - Querying
+
+- (BOOL)containsIndex:(NSUInteger)index
+{
+	NSUInteger offset = 0;
+	CBHChunk *chunk = CBHChunkFind(_root, index, NO, &offset);
+
+	return ( chunk && (chunk->mask >> offset) & 1 );
+}
+
+- (NSUInteger)positionOfIndex:(NSUInteger)index
+{
+	CBHChunk *chunk = _root;
+	NSUInteger position = 0;
+
+	while ( chunk )
+	{
+		NSUInteger leftTotal = CBHChunkTotal(chunk->left);
+
+		if ( index < leftTotal )
+		{
+			chunk = chunk->left;
+			continue;
+		}
+
+		index -= leftTotal;
+		position += CBHChunkIncluded(chunk->left);
+
+		if ( index < chunk->length )
+		{
+			return position + (NSUInteger)__builtin_popcountll(chunk->mask & (((uint64_t)1 << index) - 1));
+		}
+
+		index -= chunk->length;
+		position += (NSUInteger)__builtin_popcountll(chunk->mask);
+		chunk = chunk->right;
+	}
+
+	return position;
+}
+
+
+#pragma mark - Mutating
+
+- (void)insertIndex:(NSUInteger)index included:(BOOL)isIncluded
+{
+	if ( !_root )
+	{
+		_root = CBHChunkCreate(( isIncluded ) ? 1 : 0, 1);
+		return;
+	}
+
+	NSUInteger offset = 0;
+	CBHChunk *chunk = CBHChunkFind(_root, index, YES, &offset);
+
+	/// A full chunk is split in two, which puts the upper half in a new chunk directly after it.
+	if ( chunk->length == CBHChunkCapacity )
+	{
+		NSUInteger start = index - offset;
+		CBHChunk *before = NULL;
+		CBHChunk *rest = NULL;
+		CBHChunk *full = NULL;
+		CBHChunk *after = NULL;
+
+		CBHChunkSplit(_root, start, &before, &rest);
+		CBHChunkSplit(rest, CBHChunkCapacity, &full, &after);
+
+		CBHChunk *upper = CBHChunkCreate(full->mask >> (CBHChunkCapacity / 2), CBHChunkCapacity / 2);
+		full->mask &= ((uint64_t)1 << (CBHChunkCapacity / 2)) - 1;
+		full->length = CBHChunkCapacity / 2;
+		CBHChunkUpdate(full);
+
+		_root = CBHChunkMerge(CBHChunkMerge(before, full), CBHChunkMerge(upper, after));
+	}
+
+	_root = CBHChunkApply(_root, index, ( isIncluded ) ? CBHChunkOperationInsertIncluded : CBHChunkOperationInsertExcluded);
+}
+
+- (void)removeIndex:(NSUInteger)index
+{
+	_root = CBHChunkApply(_root, index, CBHChunkOperationRemove);
+}
+
+- (void)setIncluded:(BOOL)isIncluded atIndex:(NSUInteger)index
+{
+	_root = CBHChunkApply(_root, index, ( isIncluded ) ? CBHChunkOperationInclude : CBHChunkOperationExclude);
+}
+
+- (void)resetWithCount:(NSUInteger)count includedIndexes:(NSIndexSet *)indexes
+{
+	CBHChunkFree(_root);
+	_root = NULL;
+
+	NSUInteger chunkCount = (count + CBHChunkFill - 1) / CBHChunkFill;
+	uint64_t *masks = (uint64_t *)calloc(MAX(chunkCount, (NSUInteger)1), sizeof(uint64_t));
+
+	[indexes enumerateIndexesUsingBlock:^(NSUInteger index, BOOL *stop) {
+		masks[index / CBHChunkFill] |= (uint64_t)1 << (index % CBHChunkFill);
+	}];
+
+	for (NSUInteger chunk = 0; chunk < chunkCount; ++chunk)
+	{
+		NSUInteger length = MIN(count - chunk * CBHChunkFill, (NSUInteger)CBHChunkFill);
+		_root = CBHChunkMerge(_root, CBHChunkCreate(masks[chunk], length));
+	}
+
+	free(masks);
+}
+
+@end
@@ -0,0 +1,74 @@
+//  _CBHViewSources.h
+//  CBHMapReduceKit
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+@import Foundation;
+
+@class CBHArrayView;
+@class CBHDictionaryView;
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+/** A mutable array that applies each mutation to the source of a view and then updates the view with the indexes that changed.
+ */
+@interface CBHArrayViewSource : NSMutableArray
+
+/** Initializes a proxy for the source of a view.
+ *
+ * @param source    The array the view is over.
+ * @param view      The view to update. It is not retained.
+ *
+ * @return          The initialized proxy.
+ */
+- (instancetype)initWithSource:(NSMutableArray *)source view:(CBHArrayView *)view;
+
+@end
+
+
+/** A mutable ordered set that applies each mutation to the source of a view and then updates the view with the indexes that changed.
+ */
+@interface CBHOrderedSetViewSource : NSMutableOrderedSet
+
+/** Initializes a proxy for the source of a view.
+ *
+ * @param source    The ordered set the view is over.
+ * @param view      The view to update. It is not retained.
+ *
+ * @return          The initialized proxy.
+ */
+- (instancetype)initWithSource:(NSMutableOrderedSet *)source view:(CBHArrayView *)view;
+
+@end
+
+
+/** A mutable dictionary that applies each mutation to the source of a view and then updates the view with the key that changed.
+ */
+@interface CBHDictionaryViewSource : NSMutableDictionary
+
+/** Initializes a proxy for the source of a view.
+ *
+ * @param source    The dictionary the view is over.
+ * @param view      The view to update. It is not retained.
+ *
+ * @return          The initialized proxy.
+ */
+- (instancetype)initWithSource:(NSMutableDictionary *)source view:(CBHDictionaryView *)view;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,228 @@
+//  _CBHViewSources.m
+//  CBHMapReduceKit
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+#import "_CBHViewSources.h"
+
+#import "_CBHArrayView.h"
+#import "_CBHDictionaryView.h"
+
+
+#pragma mark - Array
+
+@implementation CBHArrayViewSource
+{
+	NSMutableArray *_source;
+	__weak CBHArrayView *_view;
+}
+
+- (instancetype)initWithSource:(NSMutableArray *)source view:(CBHArrayView *)view
+{
+	if ( (self = [super init]) )
+	{
+		_source = source;
+		_view = view;
+	}
+
+	return self;
+}
+
+- (NSUInteger)count
+{
+	return [_source count];
+}
+
+- (id)objectAtIndex:(NSUInteger)index
+{
+	return [_source objectAtIndex:index];
+}
+
+- (NSUInteger)countByEnumeratingWithState:(NSFastEnumerationState *)state objects:(id __unsafe_unretained [])buffer count:(NSUInteger)length
+{
+	return [_source countByEnumeratingWithState:state objects:buffer count:length];
+}
+
+- (void)insertObject:(id)object atIndex:(NSUInteger)index
+{
+	[_source insertObject:object atIndex:index];
+	[_view sourceDidInsertObjectsAtIndexes:[NSIndexSet indexSetWithIndex:index]];
+}
+
+- (void)removeObjectAtIndex:(NSUInteger)index
+{
+	[_source removeObjectAtIndex:index];
+	[_view sourceDidRemoveObjectsAtIndexes:[NSIndexSet indexSetWithIndex:index]];
+}
+
+- (void)addObject:(id)object
+{
+	[self insertObject:object atIndex:[_source count]];
+}
+
+- (void)removeLastObject
+{
+	[self removeObjectAtIndex:[_source count] - 1];
+}
+
+- (void)replaceObjectAtIndex:(NSUInteger)index withObject:(id)object
+{
+	[_source replaceObjectAtIndex:index withObject:object];
+	[_view sourceDidReplaceObjectsAtIndexes:[NSIndexSet indexSetWithIndex:index]];
+}
+
+- (void)removeAllObjects
+{
+	[_source removeAllObjects];
+	[_view reload];
+}
+
+@end
+
+
+#pragma mark - Ordered Set
+
+@implementation CBHOrderedSetViewSource
+{
+	NSMutableOrderedSet *_source;
+	__weak CBHArrayView *_view;
+}
+
+- (instancetype)initWithSource:(NSMutableOrderedSet *)source view:(CBHArrayView *)view
+{
+	if ( (self = [super init]) )
+	{
+		_source = source;
+		_view = view;
+	}
+
+	return self;
+}
+
+- (NSUInteger)count
+{
+	return [_source count];
+}
+
+- (id)objectAtIndex:(NSUInteger)index
+{
+	return [_source objectAtIndex:index];
+}
+
+- (NSUInteger)indexOfObject:(id)object
+{
+	return [_source indexOfObject:object];
+}
+
+- (NSUInteger)countByEnumeratingWithState:(NSFastEnumerationState *)state objects:(id __unsafe_unretained [])buffer count:(NSUInteger)length
+{
+	return [_source countByEnumeratingWithState:state objects:buffer count:length];
+}
+
+- (void)insertObject:(id)object atIndex:(NSUInteger)index
+{
+	NSUInteger count = [_source count];
+
+	[_source insertObject:object atIndex:index];
+
+	/// Objects already in the set are not inserted again.
+	if ( [_source count] != count ) { [_view sourceDidInsertObjectsAtIndexes:[NSIndexSet indexSetWithIndex:index]]; }
+}
+
+- (void)removeObjectAtIndex:(NSUInteger)index
+{
+	[_source removeObjectAtIndex:index];
+	[_view sourceDidRemoveObjectsAtIndexes:[NSIndexSet indexSetWithIndex:index]];
+}
+
+- (void)replaceObjectAtIndex:(NSUInteger)index withObject:(id)object
+{
+	NSUInteger count = [_source count];
+
+	[_source replaceObjectAtIndex:index withObject:object];
+
+	/// Replacing with an object found at another index may move or drop elements, which is not a change of a single index.
+	if ( [_source count] == count ) { [_view sourceDidReplaceObjectsAtIndexes:[NSIndexSet indexSetWithIndex:index]]; }
+	else { [_view reload]; }
+}
+
+- (void)removeAllObjects
+{
+	[_source removeAllObjects];
+	[_view reload];
+}
+
+@end
+
+
+#pragma mark - Dictionary
+
+@implementation CBHDictionaryViewSource
+{
+	NSMutableDictionary *_source;
+	__weak CBHDictionaryView *_view;
+}
+
+- (instancetype)initWithSource:(NSMutableDictionary *)source view:(CBHDictionaryView *)view
+{
+	if ( (self = [super init]) )
+	{
+		_source = source;
+		_view = view;
+	}
+
+	return self;
+}
+
+- (NSUInteger)count
+{
+	return [_source count];
+}
+
+- (id)objectForKey:(id)key
+{
+	return [_source objectForKey:key];
+}
+
+- (NSEnumerator *)keyEnumerator
+{
+	return [_source keyEnumerator];
+}
+
+- (NSUInteger)countByEnumeratingWithState:(NSFastEnumerationState *)state objects:(id __unsafe_unretained [])buffer count:(NSUInteger)length
+{
+	return [_source countByEnumeratingWithState:state objects:buffer count:length];
+}
+
+- (void)setObject:(id)object forKey:(id<NSCopying>)key
+{
+	[_source setObject:object forKey:key];
+	[_view sourceDidChangeObjectForKey:key];
+}
+
+- (void)removeObjectForKey:(id)key
+{
+	[_source removeObjectForKey:key];
+	[_view sourceDidChangeObjectForKey:key];
+}
+
+- (void)removeAllObjects
+{
+	[_source removeAllObjects];
+	[_view reload];
+}
+
+@end
@@ -0,0 +1,66 @@
+//  _CBHWindows.h
+//  CBHMapReduceKit
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+@import Foundation;
+
+
+NS_ASSUME_NONNULL_BEGIN
+
+/** Raises an `NSInvalidArgumentException` unless a window size and step are both greater than zero.
+ */
+void CBHWindowValidate(NSUInteger size, NSUInteger step);
+
+
+/** An array of the windows of another array, each created on demand as a view of a range of it.
+ */
+@interface CBHWindowArray : NSArray
+
+/** Initializes an array of windows.
+ *
+ * @param source    The immutable array to window.
+ * @param size      The number of elements in each window.
+ * @param step      The number of elements between the starts of consecutive windows.
+ * @param partial   Whether a final window with fewer than `size` elements is included.
+ *
+ * @return          The initialized array.
+ */
+- (instancetype)initWithSource:(NSArray *)source size:(NSUInteger)size step:(NSUInteger)step partial:(BOOL)partial;
+
+@end
+
+
+/** An enumerator of the windows of another enumerator that holds at most one window of elements.
+ *
+ * When windows overlap their elements are held in a ring buffer and each window is copied out of it into its own array.
+ */
+@interface CBHWindowEnumerator : NSEnumerator
+
+/** Initializes an enumerator of windows.
+ *
+ * @param source    The enumerator to window.
+ * @param size      The number of elements in each window.
+ * @param step      The number of elements between the starts of consecutive windows.
+ * @param partial   Whether a final window with fewer than `size` elements is included.
+ *
+ * @return          The initialized enumerator.
+ */
+- (instancetype)initWithSource:(NSEnumerator *)source size:(NSUInteger)size step:(NSUInteger)step partial:(BOOL)partial;
+
+@end
+
+NS_ASSUME_NONNULL_END
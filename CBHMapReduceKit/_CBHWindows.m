@@ -0,0 +1,313 @@
+//  _CBHWindows.m
+//  CBHMapReduceKit
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+#import "_CBHWindows.h"
+
+
+void CBHWindowValidate(NSUInteger size, NSUInteger step)
+{
+	if ( size > 0 && step > 0 ) { return; }
+
+	[NSException raise:NSInvalidArgumentException format:@"Window size (%lu) and step (%lu) must be greater than zero.", (unsigned long)size, (unsigned long)step];
+}
+
+
+#pragma mark - Subarray
+
+/// A view of a range of an immutable array.
+@interface CBHSubarray : NSArray
+
+- (instancetype)initWithSource:(NSArray *)source range:(NSRange)range;
+
+@end
+
+
+@implementation CBHSubarray
+{
+	NSArray *_source;
+	NSRange _range;
+}
+
+- (instancetype)initWithSource:(NSArray *)source range:(NSRange)range
+{
+	if ( (self = [super init]) )
+	{
+		_source = source;
+		_range = range;
+	}
+
+	return self;
+}
+
+- (NSUInteger)count
+{
+	return _range.length;
+}
+
+- (id)objectAtIndex:(NSUInteger)index
+{
+	if ( index >= _range.length )
+	{
+		[NSException raise:NSRangeException format:@"Index %lu beyond bounds [0 .. %lu].", (unsigned long)index, (unsigned long)_range.length];
+	}
+
+	return [_source objectAtIndex:_range.location + index];
+}
+
+- (void)getObjects:(id __unsafe_unretained [])objects range:(NSRange)range
+{
+	if ( NSMaxRange(range) > _range.length )
+	{
+		[NSException raise:NSRangeException format:@"Range %@ beyond bounds [0 .. %lu].", NSStringFromRange(range), (unsigned long)_range.length];
+	}
+
+	[_source getObjects:objects range:NSMakeRange(_range.location + range.location, range.length)];
+}
+
+- (NSArray *)subarrayWithRange:(NSRange)range
+{
+	if ( NSMaxRange(range) > _range.length )
+	{
+		[NSException raise:NSRangeException format:@"Range %@ beyond bounds [0 .. %lu].", NSStringFromRange(range), (unsigned long)_range.length];
+	}
+
+	return [[CBHSubarray alloc] initWithSource:_source range:NSMakeRange(_range.location + range.location, range.length)];
+}
+
+- (id)copyWithZone:(NSZone *)zone
+{
+	return self;
+}
+
+- (Class)classForCoder
+{
+	return [NSArray class];
+}
+
+@end
+
+
+#pragma mark - Window Array
+
+@implementation CBHWindowArray
+{
+	NSArray *_source;
+	NSUInteger _size;
+	NSUInteger _step;
+	NSUInteger _count;
+}
+
+- (instancetype)initWithSource:(NSArray *)source size:(NSUInteger)size step:(NSUInteger)step partial:(BOOL)partial
+{
+	CBHWindowValidate(size, step);
+
+	if ( (self = [super init]) )
+	{
+		_source = source;
+		_size = size;
+		_step = step;
+
+		NSUInteger count = [source count];
+
+		if ( partial ) { _count = (count + step - 1) / step; }
+		else { _count = ( count < size ) ? 0 : (count - size) / step + 1; }
+	}
+
+	return self;
+}
+
+- (NSUInteger)count
+{
+	return _count;
+}
+
+- (id)objectAtIndex:(NSUInteger)index
+{
+	if ( index >= _count )
+	{
+		[NSException raise:NSRangeException format:@"Index %lu beyond bounds [0 .. %lu].", (unsigned long)index, (unsigned long)_count];
+	}
+
+	NSUInteger location = index * _step;
+	NSUInteger length = MIN(_size, [_source count] - location);
+
+	return [[CBHSubarray alloc] initWithSource:_source range:NSMakeRange(location, length)];
+}
+
+- (id)copyWithZone:(NSZone *)zone
+{
+	return self;
+}
+
+- (Class)classForCoder
+{
+	return [NSArray class];
+}
+
+@end
+
+
+#pragma mark - Window Enumerator
+
+@implementation CBHWindowEnumerator
+{
+	NSEnumerator *_source;
+	NSUInteger _size;
+	NSUInteger _step;
+	BOOL _partial;
+
+	__strong id *_buffer;
+	NSUInteger _head;
+	NSUInteger _count;
+
+	BOOL _started;
+	BOOL _exhausted;
+
+	id _current;
+}
+
+
+#pragma mark - Initialization
+
+- (instancetype)initWithSource:(NSEnumerator *)source size:(NSUInteger)size step:(NSUInteger)step partial:(BOOL)partial
+{
+	CBHWindowValidate(size, step);
+
+	if ( (self = [super init]) )
+	{
+		_source = source;
+		_size = size;
+		_step = step;
+		_partial = partial;
+
+		/// Overlapping windows share a ring buffer. Each element is stored twice, `size` slots apart, so every window is contiguous.
+		if ( step < size ) { _buffer = (__strong id *)calloc(size * 2, sizeof(id)); }
+	}
+
+	return self;
+}
+
+- (void)dealloc
+{
+	if ( !_buffer ) { return; }
+
+	for (NSUInteger i = 0; i < _size * 2; ++i) { _buffer[i] = nil; }
+	free(_buffer);
+}
+
+
+#pragma mark - NSEnumerator
+
+- (id)nextObject
+{
+	if ( _exhausted ) { return nil; }
+
+	if ( !_buffer ) { return [self nextDisjointWindow]; }
+
+	if ( _started )
+	{
+		/// Slide past `step` elements, releasing them as they leave the window.
+		for (NSUInteger i = 0; i < _step; ++i)
+		{
+			NSUInteger slot = (_head + i) % _size;
+			_buffer[slot] = nil;
+			_buffer[slot + _size] = nil;
+		}
+
+		_head = (_head + _step) % _size;
+		_count -= _step;
+	}
+
+	_started = YES;
+
+	while ( _count < _size )
+	{
+		id object = [_source nextObject];
+		if ( !object ) { break; }
+
+		NSUInteger slot = (_head + _count) % _size;
+		_buffer[slot] = object;
+		_buffer[slot + _size] = object;
+		++_count;
+	}
+
+	if ( _count < _size )
+	{
+		_exhausted = YES;
+		return nil;
+	}
+
+	/// Copy the window out so that it stays valid once the buffer slides on.
+	return [[NSArray alloc] initWithObjects:_buffer + _head count:_count];
+}
+
+- (NSUInteger)countByEnumeratingWithState:(NSFastEnumerationState *)state objects:(id __unsafe_unretained [])buffer count:(NSUInteger)length
+{
+	/// Hand out one window at a time so that no more are pulled from the source than have been asked for.
+	if ( state->state == 0 )
+	{
+		state->state = 1;
+		state->mutationsPtr = &state->extra[0];
+	}
+
+	_current = [self nextObject];
+	if ( !_current ) { return 0; }
+
+	buffer[0] = _current;
+	state->itemsPtr = buffer;
+
+	return 1;
+}
+
+
+#pragma mark - Helpers
+
+- (NSArray *)nextDisjointWindow
+{
+	if ( _started )
+	{
+		/// Skip the elements between windows when the step is longer than a window.
+		for (NSUInteger i = _size; i < _step; ++i)
+		{
+			if ( ![_source nextObject] ) { _exhausted = YES; return nil; }
+		}
+	}
+
+	_started = YES;
+
+	NSMutableArray *window = [[NSMutableArray alloc] initWithCapacity:_size];
+
+	while ( [window count] < _size )
+	{
+		id object = [_source nextObject];
+		if ( !object ) { break; }
+
+		[window addObject:object];
+	}
+
+	if ( [window count] < _size )
+	{
+		_exhausted = YES;
+		if ( !_partial || [window count] == 0 ) { return nil; }
+	}
+
+	return window;
+}
+
+
+@end
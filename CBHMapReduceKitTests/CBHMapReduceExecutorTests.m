@@ -0,0 +1,158 @@
+//  CBHMapReduceExecutorTests.m
+//  CBHMapReduceKitTests
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+@import XCTest;
+@import CBHMapReduceKit;
+
+
+/// An executor that runs each index as its own range, in reverse, counting the ranges it is given.
+@interface CBHReversingExecutor : CBHMapReduceExecutor
+
+@property (nonatomic) NSUInteger rangeCount;
+
+@end
+
+
+@implementation CBHReversingExecutor
+
+- (void)applyRangesOfCount:(NSUInteger)count block:(void (^)(NSRange range))block
+{
+	for (NSUInteger i = count; i > 0; --i)
+	{
+		[self setRangeCount:[self rangeCount] + 1];
+		block(NSMakeRange(i - 1, 1));
+	}
+}
+
+@end
+
+
+@interface CBHMapReduceExecutorTests : XCTestCase
+@end
+
+
+@implementation CBHMapReduceExecutorTests
+
+#pragma mark - Helpers
+
+- (void)assertExecutor:(CBHMapReduceExecutor *)executor coversCount:(NSUInteger)count
+{
+	NSMutableData *visits = [NSMutableData dataWithLength:count];
+	uint8_t *bytes = [visits mutableBytes];
+
+	[executor applyRangesOfCount:count block:^(NSRange range) {
+		for (NSUInteger i = range.location; i < NSMaxRange(range); ++i) { bytes[i] += 1; }
+	}];
+
+	for (NSUInteger i = 0; i < count; ++i)
+	{
+		XCTAssertEqual(bytes[i], (uint8_t)1, @"Each index should be visited exactly once.");
+	}
+}
+
+
+#pragma mark - Coverage
+
+- (void)testSerial
+{
+	[self assertExecutor:[CBHMapReduceExecutor serialExecutor] coversCount:1000];
+	[self assertExecutor:[CBHMapReduceExecutor serialExecutor] coversCount:0];
+}
+
+- (void)testDispatch
+{
+	[self assertExecutor:[CBHMapReduceExecutor dispatchExecutor] coversCount:1000];
+	[self assertExecutor:[CBHMapReduceExecutor dispatchExecutorWithWorkerCount:3] coversCount:7];
+	[self assertExecutor:[CBHMapReduceExecutor dispatchExecutorWithWorkerCount:8] coversCount:1];
+}
+
+- (void)testWorkStealing
+{
+	[self assertExecutor:[CBHMapReduceExecutor workStealingExecutor] coversCount:100000];
+	[self assertExecutor:[CBHMapReduceExecutor workStealingExecutorWithWorkerCount:3] coversCount:7];
+	[self assertExecutor:[CBHMapReduceExecutor workStealingExecutorWithWorkerCount:8] coversCount:1];
+}
+
+- (void)testWorkStealing_skewed
+{
+	CBHMapReduceExecutor *executor = [CBHMapReduceExecutor workStealingExecutorWithWorkerCount:4];
+	NSUInteger count = 4096;
+	NSMutableData *visits = [NSMutableData dataWithLength:count];
+	uint8_t *bytes = [visits mutableBytes];
+
+	[executor applyRangesOfCount:count block:^(NSRange range) {
+		for (NSUInteger i = range.location; i < NSMaxRange(range); ++i)
+		{
+			if ( i < 8 ) { usleep(10000); }
+			bytes[i] += 1;
+		}
+	}];
+
+	for (NSUInteger i = 0; i < count; ++i)
+	{
+		XCTAssertEqual(bytes[i], (uint8_t)1, @"Each index should be visited exactly once.");
+	}
+}
+
+
+- (void)testWorkStealing_idleWorkersStop
+{
+	CBHMapReduceExecutor *executor = [CBHMapReduceExecutor workStealingExecutorWithWorkerCount:4];
+	clock_t start = clock();
+
+	/// Only one element is slow, so the other workers run out of work to steal almost immediately and should not spin through its tail.
+	[executor applyRangesOfCount:64 block:^(NSRange range) {
+		if ( NSLocationInRange(0, range) ) { usleep(200000); }
+	}];
+
+	double cpuSeconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+	XCTAssertLessThan(cpuSeconds, 0.1, @"Idle workers should stop instead of spinning while the slow element finishes.");
+}
+
+- (void)testCustom
+{
+	CBHReversingExecutor *executor = [[CBHReversingExecutor alloc] initWithWorkerCount:2];
+	[self assertExecutor:executor coversCount:100];
+
+	NSArray<NSNumber *> *array = @[@1, @2, @3, @4, @5];
+	NSArray<NSNumber *> *mapping = [array arrayByMapping:^id(NSNumber *object) {
+		return @([object integerValue] * 10);
+	} executor:executor];
+	NSArray<NSNumber *> *expected = @[@10, @20, @30, @40, @50];
+
+	XCTAssertEqualObjects(mapping, expected, @"The two arrays should be the same.");
+	XCTAssertEqual([executor workerCount], (NSUInteger)2, @"The worker count should be the one it was initialized with.");
+	XCTAssertEqual([executor rangeCount], (NSUInteger)105, @"The custom executor should schedule every range.");
+}
+
+
+#pragma mark - Default
+
+- (void)testDefault
+{
+	CBHMapReduceExecutor *original = [CBHMapReduceExecutor defaultExecutor];
+	CBHMapReduceExecutor *serial = [CBHMapReduceExecutor serialExecutor];
+
+	[CBHMapReduceExecutor setDefaultExecutor:serial];
+	XCTAssertEqual([CBHMapReduceExecutor defaultExecutor], serial, @"The default executor should be replaceable.");
+
+	[CBHMapReduceExecutor setDefaultExecutor:original];
+	XCTAssertEqual([serial workerCount], (NSUInteger)1, @"A serial executor has one worker.");
+}
+
+@end
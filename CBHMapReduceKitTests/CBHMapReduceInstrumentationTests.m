@@ -0,0 +1,149 @@
+//  CBHMapReduceInstrumentationTests.m
+//  CBHMapReduceKitTests
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+@import XCTest;
+@import CBHMapReduceKit;
+
+
+@interface CBHMapReduceInstrumentationTests : XCTestCase <CBHMapReduceObserver>
+@end
+
+
+@implementation CBHMapReduceInstrumentationTests
+{
+	NSMutableArray<CBHMapReduceCallRecord *> *_records;
+}
+
+- (void)setUp
+{
+	_records = [NSMutableArray array];
+}
+
+- (void)mapReduceDidCompleteCall:(CBHMapReduceCallRecord *)record
+{
+	[_records addObject:record];
+}
+
+
+#pragma mark - Observing
+
+- (void)testScopedObserver
+{
+	NSArray<NSNumber *> *array = @[@1, @2, @3, @4, @5, @6, @7, @8, @9, @10];
+
+	[CBHMapReduceInstrumentation performWithObserver:self block:^{
+		[array arrayByFiltering:^BOOL(NSNumber *object) {
+			return ( [object unsignedIntValue] % 2 == 0 );
+		}];
+	}];
+
+	XCTAssertEqual([_records count], (NSUInteger)1, @"Only the outermost call should be recorded.");
+
+	CBHMapReduceCallRecord *record = [_records firstObject];
+	XCTAssertEqualObjects([record category], @"NSArray", @"The category should be the receiver's.");
+	XCTAssertEqual([record selector], @selector(arrayByFiltering:), @"The selector should be the one called.");
+	XCTAssertEqual([record inputCount], (NSUInteger)10, @"Every element should be passed to the closure.");
+	XCTAssertEqual([record outputCount], (NSUInteger)5, @"The result should have five elements.");
+	XCTAssertEqual([record containerCount], (NSUInteger)1, @"One result should be allocated.");
+
+	[array initial:@0 reduce:^NSNumber *(NSNumber *memo, NSNumber *object) {
+		return @([memo unsignedIntegerValue] + [object unsignedIntValue]);
+	}];
+
+	XCTAssertEqual([_records count], (NSUInteger)1, @"Calls outside the scope should not be recorded.");
+}
+
+- (void)testBlockDuration
+{
+	NSArray<NSNumber *> *array = @[@1, @2, @3, @4, @5];
+
+	[CBHMapReduceInstrumentation performWithObserver:self block:^{
+		[array arrayByMapping:^id(NSNumber *object) {
+			[NSThread sleepForTimeInterval:0.002];
+			return object;
+		}];
+	}];
+
+	CBHMapReduceCallRecord *record = [_records firstObject];
+	XCTAssertGreaterThanOrEqual([record blockDuration], (uint64_t)(5 * 2 * NSEC_PER_MSEC), @"The time slept in the closure should be counted.");
+	XCTAssertGreaterThanOrEqual([record duration], [record blockDuration], @"A serial call should take at least as long as its closure.");
+}
+
+- (void)testScanningAndWindowing
+{
+	NSArray<NSNumber *> *array = @[@1, @2, @3, @4, @5];
+
+	[CBHMapReduceInstrumentation performWithObserver:self block:^{
+		[array initialDouble:0 scan:^double(double accumulated, NSNumber *object) {
+			return accumulated + [object doubleValue];
+		}];
+		[array windowedReduceOfSize:2 initial:@0 add:^NSNumber *(NSNumber *memo, NSNumber *object) {
+			return @([memo integerValue] + [object integerValue]);
+		} remove:^NSNumber *(NSNumber *memo, NSNumber *object) {
+			return @([memo integerValue] - [object integerValue]);
+		}];
+		[array chunksOfSize:2];
+	}];
+
+	XCTAssertEqual([_records count], (NSUInteger)3, @"Every call should be recorded.");
+
+	XCTAssertEqual([_records[0] selector], @selector(initialDouble:scan:), @"The selector should be the one called.");
+	XCTAssertEqual([_records[0] inputCount], (NSUInteger)5, @"Every element should be passed to the closure.");
+	XCTAssertEqual([_records[0] outputCount], (NSUInteger)5, @"Each double of the result should be counted.");
+
+	XCTAssertEqual([_records[1] inputCount], (NSUInteger)5, @"Only the elements added to the window should be counted as inputs.");
+
+	XCTAssertEqual([_records[2] containerCount], (NSUInteger)4, @"The result and each of its three chunks should be counted.");
+}
+
+- (void)testGlobalObserver
+{
+	NSMutableArray<NSNumber *> *array = [@[@1, @2, @3] mutableCopy];
+
+	[CBHMapReduceInstrumentation setObserver:self];
+	NSNumber *reduction = [array initial:@0 reduce:^NSNumber *(NSNumber *memo, NSNumber *object) {
+		return @([memo unsignedIntegerValue] + [object unsignedIntValue]);
+	}];
+	[array filter:^BOOL(NSNumber *object) { return YES; }];
+	[CBHMapReduceInstrumentation setObserver:nil];
+
+	[array filter:^BOOL(NSNumber *object) { return YES; }];
+
+	XCTAssertEqualObjects(reduction, @6, @"The two numbers should be the same.");
+	XCTAssertEqual([_records count], (NSUInteger)2, @"Only calls while the observer is installed should be recorded.");
+	XCTAssertEqual([_records[0] outputCount], (NSUInteger)1, @"A reduction should have one output.");
+	XCTAssertEqual([_records[1] containerCount], (NSUInteger)0, @"Mutating in place should not allocate a result.");
+	XCTAssertEqualObjects([_records[1] dictionaryRepresentation][@"selector"], @"filter:", @"The selector should be exported as a string.");
+}
+
+- (void)testException
+{
+	NSArray<NSNumber *> *array = @[@1, @2, @3];
+
+	[CBHMapReduceInstrumentation performWithObserver:self block:^{
+		XCTAssertThrows([array arrayByMapping:^id(NSNumber *object) {
+			@throw [NSException exceptionWithName:NSInternalInconsistencyException reason:@"Thrown by the closure." userInfo:nil];
+		}], @"The exception should reach the caller.");
+
+		[array arrayByMapping:^id(NSNumber *object) { return object; }];
+	}];
+
+	XCTAssertEqual([_records count], (NSUInteger)1, @"A call after one that threw should be recorded.");
+}
+
+@end
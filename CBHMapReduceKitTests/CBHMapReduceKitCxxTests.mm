@@ -0,0 +1,159 @@
+//  CBHMapReduceKitCxxTests.mm
+//  CBHMapReduceKitTests
+//
+//  Created by Christian Huxtable <chris@huxtable.ca>, October 2026.
+//  Copyright (c) 2026 Christian Huxtable. All rights reserved.
+//
+//  Permission to use, copy, modify, and/or distribute this software for any
+//  purpose with or without fee is hereby granted, provided that the above
+//  copyright notice and this permission notice appear in all copies.
+//
+//  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+//  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+//  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+//  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+//  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+//  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+//  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+
+@import XCTest;
+@import CBHMapReduceKit;
+
+#import <CBHMapReduceKit/CBHMapReduceKit.hpp>
+
+
+@interface CBHMapReduceKitCxxTests : XCTestCase
+@end
+
+
+@implementation CBHMapReduceKitCxxTests
+
+#pragma mark - Mapping
+
+- (void)testMapping
+{
+	NSArray<NSNumber *> *array = @[@1, @2, @3, @4, @5];
+	NSArray *mapping = cbh::map(array, [](NSNumber *object) {
+		return [NSString stringWithFormat:@"%lu", [object unsignedIntegerValue] * 2];
+	});
+	NSArray<NSString *> *expected = @[@"2", @"4", @"6", @"8", @"10"];
+
+	XCTAssertEqualObjects(mapping, expected, @"The two arrays should be the same.");
+}
+
+- (void)testMapping_toSet
+{
+	NSOrderedSet<NSNumber *> *orderedSet = [NSOrderedSet orderedSetWithArray:@[@1, @2, @3, @4, @5]];
+	NSSet *mapping = cbh::map<NSSet *>(orderedSet, [](NSNumber *object) {
+		return @([object unsignedIntegerValue] % 2);
+	});
+	NSSet<NSNumber *> *expected = [NSSet setWithArray:@[@0, @1]];
+
+	XCTAssertEqualObjects(mapping, expected, @"The two sets should be the same.");
+}
+
+- (void)testMapping_dictionary
+{
+	NSDictionary<NSString *, NSNumber *> *dictionary = @{@"a": @1, @"b": @2};
+	NSDictionary *mapping = cbh::map<NSDictionary *>(dictionary, [](NSString *key, NSNumber *value) {
+		return [key stringByAppendingString:[value stringValue]];
+	});
+	NSDictionary<NSString *, NSString *> *expected = @{@"a": @"a1", @"b": @"b2"};
+
+	XCTAssertEqualObjects(mapping, expected, @"The two dictionaries should be the same.");
+}
+
+- (void)testCompactMapping
+{
+	NSEnumerator<NSNumber *> *enumerator = [@[@1, @2, @3, @4, @5, @6, @7, @8, @9, @10] objectEnumerator];
+	NSArray *mapping = cbh::compactMap(enumerator, [](NSNumber *object) -> id {
+		NSUInteger value = [object unsignedIntegerValue];
+		if ( value % 2 == 0 ) { return nil; }
+		return [NSString stringWithFormat:@"%lu", value + value];
+	});
+	NSArray<NSString *> *expected = @[@"2", @"6", @"10", @"14", @"18"];
+
+	XCTAssertEqualObjects(mapping, expected, @"The two arrays should be the same.");
+}
+
+- (void)testMapping_large
+{
+	NSMutableArray<NSNumber *> *array = [NSMutableArray arrayWithCapacity:1000];
+	for (NSUInteger i = 0; i < 1000; ++i) { [array addObject:@(i)]; }
+
+	NSArray *mapping = cbh::map(array, [](NSNumber *object) { return object; });
+
+	XCTAssertEqualObjects(mapping, array, @"The two arrays should be the same.");
+}
+
+
+#pragma mark - Filtering
+
+- (void)testFiltering
+{
+	NSArray<NSNumber *> *array = @[@1, @2, @3, @4, @5, @6, @7, @8, @9, @10];
+	NSArray *filtered = cbh::filter(array, [](NSNumber *object) {
+		return ( [object unsignedIntValue] % 2 == 0 );
+	});
+	NSArray<NSNumber *> *expected = @[@2, @4, @6, @8, @10];
+
+	XCTAssertEqualObjects(filtered, expected, @"The two arrays should be the same.");
+}
+
+- (void)testFiltering_set
+{
+	NSSet<NSNumber *> *set = [NSSet setWithArray:@[@1, @2, @3, @4, @5, @6, @7, @8, @9, @10]];
+	NSSet *filtered = cbh::filter(set, [](NSNumber *object) {
+		return ( [object unsignedIntValue] % 2 == 0 );
+	});
+	NSSet<NSNumber *> *expected = [NSSet setWithArray:@[@2, @4, @6, @8, @10]];
+
+	XCTAssertEqualObjects(filtered, expected, @"The two sets should be the same.");
+}
+
+- (void)testFiltering_dictionary
+{
+	NSDictionary<NSString *, NSNumber *> *dictionary = @{@"a": @1, @"b": @2, @"c": @3};
+	NSDictionary *filtered = cbh::filter(dictionary, [](NSString *key, NSNumber *value) {
+		return ( [value unsignedIntValue] != 2 );
+	});
+	NSDictionary<NSString *, NSNumber *> *expected = @{@"a": @1, @"c": @3};
+
+	XCTAssertEqualObjects(filtered, expected, @"The two dictionaries should be the same.");
+}
+
+- (void)testFiltering_toDictionary
+{
+	NSArray<NSString *> *array = @[@"a", @"bb", @"ccc", @"dd"];
+	NSDictionary *filtered = cbh::filter<NSDictionary *>(array, [](NSString *object) {
+		return ( [object length] == 2 );
+	});
+	NSDictionary<NSString *, NSString *> *expected = @{@"bb": @"bb", @"dd": @"dd"};
+
+	XCTAssertEqualObjects(filtered, expected, @"The two dictionaries should be the same.");
+}
+
+
+#pragma mark - Reducing
+
+- (void)testReduce
+{
+	NSArray<NSNumber *> *array = @[@1, @2, @3, @4, @5, @6, @7, @8, @9, @10];
+	NSUInteger reduction = cbh::reduce(array, (NSUInteger)0, [](NSUInteger memo, NSNumber *object) {
+		return memo + [object unsignedIntegerValue];
+	});
+
+	XCTAssertEqual(reduction, (NSUInteger)55, @"The two numbers should be the same.");
+}
+
+- (void)testReduce_boxed
+{
+	NSOrderedSet<NSNumber *> *orderedSet = [NSOrderedSet orderedSetWithArray:@[@1, @2, @3, @4, @5, @6, @7, @8, @9, @10]];
+	NSNumber *reduction = cbh::reduce(orderedSet, @0, [](NSNumber *memo, NSNumber *object) {
+		return @([memo unsignedIntegerValue] + [object unsignedIntegerValue]);
+	});
+
+	XCTAssertEqualObjects(reduction, @55, @"The two numbers should be the same.");
+}
+
+@end
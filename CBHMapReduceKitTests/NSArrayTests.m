@@ -20,6 +20,28 @@
 @import CBHMapReduceKit;
 
 
+/// An executor that runs each index as its own range, in order, counting the ranges it is given.
+@interface CBHCountingExecutor : CBHMapReduceExecutor
+
+@property (nonatomic) NSUInteger rangeCount;
+
+@end
+
+
+@implementation CBHCountingExecutor
+
+- (void)applyRangesOfCount:(NSUInteger)count block:(void (^)(NSRange range))block
+{
+	for (NSUInteger i = 0; i < count; ++i)
+	{
+		[self setRangeCount:[self rangeCount] + 1];
+		block(NSMakeRange(i, 1));
+	}
+}
+
+@end
+
+
 @interface NSArrayTests : XCTestCase
 @end
 
@@ -41,6 +63,24 @@
 	XCTAssertEqualObjects(mapping, expected, @"The two arrays should be the same.");
 }
 
+- (void)testMapping_executor
+{
+	NSMutableArray<NSNumber *> *array = [NSMutableArray arrayWithCapacity:10000];
+	for (NSUInteger i = 0; i < 10000; ++i) { [array addObject:@(i)]; }
+
+	id (^transform)(NSNumber *) = ^id(NSNumber *object) {
+		NSUInteger value = [object unsignedIntegerValue];
+		if ( value % 3 == 0 ) { return nil; }
+		return [NSString stringWithFormat:@"%lu", value + value];
+	};
+
+	NSArray<NSString *> *expected = [array arrayByMapping:transform];
+
+	XCTAssertEqualObjects([array arrayByMapping:transform executor:[CBHMapReduceExecutor serialExecutor]], expected, @"The two arrays should be the same.");
+	XCTAssertEqualObjects([array arrayByMapping:transform executor:[CBHMapReduceExecutor dispatchExecutor]], expected, @"The two arrays should be the same.");
+	XCTAssertEqualObjects([array arrayByMapping:transform executor:[CBHMapReduceExecutor workStealingExecutor]], expected, @"The two arrays should be the same.");
+}
+
 - (void)testFiltering
 {
 	NSArray<NSNumber *> *array = @[@1, @2, @3, @4, @5, @6, @7, @8, @9, @10];
@@ -52,6 +92,39 @@
 	XCTAssertEqualObjects(mapping, expected, @"The two arrays should be the same.");
 }
 
+- (void)testFiltering_executor
+{
+	NSMutableArray<NSNumber *> *array = [NSMutableArray arrayWithCapacity:10000];
+	for (NSUInteger i = 0; i < 10000; ++i) { [array addObject:@(i)]; }
+
+	BOOL (^predicate)(NSNumber *) = ^BOOL(NSNumber *object) {
+		return ( [object unsignedIntegerValue] % 3 != 0 );
+	};
+
+	NSArray<NSNumber *> *expected = [array arrayByFiltering:predicate];
+
+	XCTAssertEqualObjects([array arrayByFiltering:predicate executor:[CBHMapReduceExecutor serialExecutor]], expected, @"The two arrays should be the same.");
+	XCTAssertEqualObjects([array arrayByFiltering:predicate executor:[CBHMapReduceExecutor dispatchExecutor]], expected, @"The two arrays should be the same.");
+	XCTAssertEqualObjects([array mutableArrayByFiltering:predicate executor:[CBHMapReduceExecutor workStealingExecutor]], expected, @"The two arrays should be the same.");
+	XCTAssertEqualObjects([@[] arrayByFiltering:predicate executor:[CBHMapReduceExecutor workStealingExecutor]], @[], @"The two arrays should be the same.");
+}
+
+- (void)testFiltering_chunks
+{
+	NSMutableArray<NSNumber *> *array = [NSMutableArray arrayWithCapacity:1000];
+	for (NSUInteger i = 0; i < 1000; ++i) { [array addObject:@(i)]; }
+
+	BOOL (^predicate)(NSNumber *) = ^BOOL(NSNumber *object) {
+		return ( [object unsignedIntegerValue] % 3 != 0 );
+	};
+
+	CBHCountingExecutor *executor = [[CBHCountingExecutor alloc] initWithWorkerCount:4];
+	NSArray<NSNumber *> *filtered = [array arrayByFiltering:predicate executor:executor];
+
+	XCTAssertEqualObjects(filtered, [array arrayByFiltering:predicate], @"The two arrays should be the same.");
+	XCTAssertGreaterThan([executor rangeCount], (NSUInteger)8, @"A short array should be split into several chunks for each pass.");
+}
+
 - (void)testReduce
 {
 	NSArray<NSNumber *> *array = @[@1, @2, @3, @4, @5, @6, @7, @8, @9, @10];
@@ -63,6 +136,196 @@
 	XCTAssertEqualObjects(reduction, expected, @"The two numbers should be the same.");
 }
 
+- (void)testAssociativeReduce
+{
+	NSMutableArray<NSNumber *> *array = [NSMutableArray arrayWithCapacity:10000];
+	for (NSUInteger i = 0; i < 10000; ++i) { [array addObject:@(i)]; }
+
+	NSString *(^combine)(NSString *, id) = ^NSString *(NSString *lhs, id rhs) {
+		return [lhs stringByAppendingString:[rhs description]];
+	};
+
+	/// Concatenation is associative but not commutative, so the chunks must be combined in order.
+	NSString *expected = [array initial:@">" reduce:combine];
+
+	XCTAssertEqualObjects([array initial:@">" associativeReduce:combine executor:[CBHMapReduceExecutor dispatchExecutor]], expected, @"The two strings should be the same.");
+	XCTAssertEqualObjects([array initial:@">" associativeReduce:combine executor:[CBHMapReduceExecutor workStealingExecutorWithWorkerCount:4]], expected, @"The two strings should be the same.");
+	XCTAssertEqualObjects([@[] initial:@">" associativeReduce:combine executor:[CBHMapReduceExecutor workStealingExecutor]], @">", @"The two strings should be the same.");
+}
+
+- (void)testScan
+{
+	NSArray<NSNumber *> *array = @[@1, @2, @3, @4, @5];
+	NSArray<NSNumber *> *scans = [array initial:@0 scan:^NSNumber *(NSNumber *memo, NSNumber *object) {
+		return @([memo unsignedIntegerValue] + [object unsignedIntValue]);
+	}];
+	NSArray<NSNumber *> *expected = @[@1, @3, @6, @10, @15];
+
+	XCTAssertEqualObjects(scans, expected, @"The two arrays should be the same.");
+}
+
+- (void)testExclusiveScan
+{
+	NSArray<NSNumber *> *array = @[@1, @2, @3, @4, @5];
+	NSArray<NSNumber *> *scans = [array initial:@0 exclusiveScan:^NSNumber *(NSNumber *memo, NSNumber *object) {
+		return @([memo unsignedIntegerValue] + [object unsignedIntValue]);
+	}];
+	NSArray<NSNumber *> *expected = @[@0, @1, @3, @6, @10];
+
+	XCTAssertEqualObjects(scans, expected, @"The two arrays should be the same.");
+}
+
+- (void)testScan_nil
+{
+	NSArray<NSNumber *> *array = @[@1, @2, @3, @4];
+
+	/// Odd elements reset the running total to `nil`, which the scans record as `NSNull`.
+	id (^scan)(NSNumber *, NSNumber *) = ^id(NSNumber *memo, NSNumber *object) {
+		if ( [object unsignedIntegerValue] % 2 != 0 ) { return nil; }
+		return @([memo unsignedIntegerValue] + [object unsignedIntegerValue]);
+	};
+
+	NSArray *scans = [array initial:nil scan:scan];
+	NSArray *expected = @[[NSNull null], @2, [NSNull null], @4];
+	XCTAssertEqualObjects(scans, expected, @"The two arrays should be the same.");
+
+	NSArray *exclusiveScans = [array initial:nil exclusiveScan:scan];
+	NSArray *exclusiveExpected = @[[NSNull null], [NSNull null], @2, [NSNull null]];
+	XCTAssertEqualObjects(exclusiveScans, exclusiveExpected, @"The two arrays should be the same.");
+
+	XCTAssertEqualObjects([[array objectEnumerator] initial:nil exclusiveScan:scan], exclusiveExpected, @"The two arrays should be the same.");
+}
+
+- (void)testDoubleScan
+{
+	NSArray<NSNumber *> *array = @[@1, @5, @3, @7, @2];
+	NSData *scans = [array initialDouble:0 scan:^double(double memo, NSNumber *object) {
+		return MAX(memo, [object doubleValue]);
+	}];
+	const double expected[] = {1, 5, 5, 7, 7};
+
+	XCTAssertEqualObjects(scans, [NSData dataWithBytes:expected length:sizeof(expected)], @"The two scans should be the same.");
+}
+
+- (void)testAssociativeScan
+{
+	NSMutableArray<NSNumber *> *array = [NSMutableArray arrayWithCapacity:100000];
+	for (NSUInteger i = 0; i < 100000; ++i) { [array addObject:@(i % 7)]; }
+
+	CBHMapReduceExecutor *executor = [CBHMapReduceExecutor workStealingExecutorWithWorkerCount:4];
+
+	NSArray<NSNumber *> *scans = [array initial:@3 associativeScan:^NSNumber *(NSNumber *lhs, NSNumber *rhs) {
+		return @([lhs unsignedIntegerValue] + [rhs unsignedIntegerValue]);
+	} executor:executor];
+	NSArray<NSNumber *> *expected = [array initial:@3 scan:^NSNumber *(NSNumber *memo, NSNumber *object) {
+		return @([memo unsignedIntegerValue] + [object unsignedIntegerValue]);
+	}];
+
+	XCTAssertEqualObjects(scans, expected, @"The two arrays should be the same.");
+
+	NSData *doubleScans = [array initialDouble:3 value:^double(NSNumber *object) {
+		return [object doubleValue];
+	} associativeScan:^double(double lhs, double rhs) {
+		return lhs + rhs;
+	} executor:executor];
+	NSData *doubleExpected = [array initialDouble:3 scan:^double(double memo, NSNumber *object) {
+		return memo + [object doubleValue];
+	}];
+
+	XCTAssertEqualObjects(doubleScans, doubleExpected, @"The two scans should be the same.");
+}
+
+- (void)testAssociativeScan_nil
+{
+	/// A zero absorbs every total into `nil`, which is associative, and the scans record it as `NSNull`.
+	id (^combine)(NSNumber *, NSNumber *) = ^id(NSNumber *lhs, NSNumber *rhs) {
+		if ( !lhs || !rhs || [lhs unsignedIntegerValue] == 0 || [rhs unsignedIntegerValue] == 0 ) { return nil; }
+		return @([lhs unsignedIntegerValue] + [rhs unsignedIntegerValue]);
+	};
+
+	CBHMapReduceExecutor *executor = [CBHMapReduceExecutor workStealingExecutorWithWorkerCount:4];
+
+	/// The shorter array is scanned serially, and the longer one in chunks.
+	for (NSNumber *length in @[@1000, @100000])
+	{
+		NSUInteger count = [length unsignedIntegerValue];
+		NSMutableArray<NSNumber *> *array = [NSMutableArray arrayWithCapacity:count];
+		for (NSUInteger i = 0; i < count; ++i) { [array addObject:@(i % 7 + 1)]; }
+		[array replaceObjectAtIndex:count / 2 withObject:@0];
+
+		NSArray *expected = [array initial:@3 scan:combine];
+		XCTAssertEqualObjects([expected lastObject], [NSNull null], @"The scans should record nil as NSNull.");
+
+		NSArray *scans = [array initial:@3 associativeScan:combine executor:executor];
+		XCTAssertEqualObjects(scans, expected, @"The two arrays should be the same.");
+	}
+}
+
+- (void)testChunks
+{
+	NSArray<NSNumber *> *array = @[@1, @2, @3, @4, @5, @6, @7];
+	NSArray<NSArray<NSNumber *> *> *chunks = [array chunksOfSize:3];
+	NSArray<NSArray<NSNumber *> *> *expected = @[@[@1, @2, @3], @[@4, @5, @6], @[@7]];
+
+	XCTAssertEqualObjects(chunks, expected, @"The two arrays should be the same.");
+}
+
+- (void)testWindows
+{
+	NSArray<NSNumber *> *array = @[@1, @2, @3, @4, @5, @6, @7];
+	NSArray<NSArray<NSNumber *> *> *windows = [array windowsOfSize:3 step:2];
+	NSArray<NSArray<NSNumber *> *> *expected = @[@[@1, @2, @3], @[@3, @4, @5], @[@5, @6, @7]];
+
+	XCTAssertEqualObjects(windows, expected, @"The two arrays should be the same.");
+	XCTAssertEqualObjects([windows[1] subarrayWithRange:NSMakeRange(1, 2)], (@[@4, @5]), @"The two arrays should be the same.");
+	XCTAssertEqual([[array windowsOfSize:8 step:1] count], (NSUInteger)0, @"There should be no full windows.");
+	XCTAssertThrowsSpecificNamed([array windowsOfSize:0 step:1], NSException, NSInvalidArgumentException, @"An empty window should be rejected.");
+}
+
+- (void)testWindowedReduce
+{
+	NSArray<NSNumber *> *array = @[@1, @2, @3, @4, @5, @6];
+	NSArray<NSNumber *> *sums = [array windowedReduceOfSize:3 initial:@0 add:^NSNumber *(NSNumber *memo, NSNumber *object) {
+		return @([memo integerValue] + [object integerValue]);
+	} remove:^NSNumber *(NSNumber *memo, NSNumber *object) {
+		return @([memo integerValue] - [object integerValue]);
+	}];
+	NSArray<NSNumber *> *expected = @[@6, @9, @12, @15];
+
+	XCTAssertEqualObjects(sums, expected, @"The two arrays should be the same.");
+
+	NSData *doubleSums = [array windowedReduceOfSize:3 initialDouble:0 add:^double(double memo, NSNumber *object) {
+		return memo + [object doubleValue];
+	} remove:^double(double memo, NSNumber *object) {
+		return memo - [object doubleValue];
+	}];
+	const double doubleExpected[] = {6, 9, 12, 15};
+
+	XCTAssertEqualObjects(doubleSums, [NSData dataWithBytes:doubleExpected length:sizeof(doubleExpected)], @"The two reductions should be the same.");
+}
+
+- (void)testWindowedReduce_nil
+{
+	NSArray<NSNumber *> *array = @[@1, @2, @3, @5, @7, @4];
+
+	/// Counts the even elements of each window, with `nil` standing in for none, which the reductions record as `NSNull`.
+	id (^add)(NSNumber *, NSNumber *) = ^id(NSNumber *memo, NSNumber *object) {
+		if ( [object integerValue] % 2 != 0 ) { return memo; }
+		return @([memo integerValue] + 1);
+	};
+	id (^remove)(NSNumber *, NSNumber *) = ^id(NSNumber *memo, NSNumber *object) {
+		if ( [object integerValue] % 2 != 0 ) { return memo; }
+		return ( [memo integerValue] > 1 ) ? @([memo integerValue] - 1) : nil;
+	};
+
+	NSArray *counts = [array windowedReduceOfSize:2 initial:nil add:add remove:remove];
+	NSArray *expected = @[@1, @1, [NSNull null], [NSNull null], @1];
+	XCTAssertEqualObjects(counts, expected, @"The two arrays should be the same.");
+
+	NSArray *enumeratedCounts = [[array objectEnumerator] windowedReduceOfSize:2 initial:nil add:add remove:remove];
+	XCTAssertEqualObjects(enumeratedCounts, expected, @"The two arrays should be the same.");
+}
+
 
 #pragma mark - Cross Collection
 
@@ -93,6 +356,158 @@
 }
 
 
+#pragma mark - Joining
+
+- (void)testJoin
+{
+	NSArray<NSNumber *> *array = @[@1, @2, @3, @4, @5, @6, @7, @8, @9, @10];
+	NSArray<NSString *> *other = @[@"1", @"4", @"4", @"9", @"16"];
+	NSArray<NSString *> *joined = [array joinWith:other leftKey:^id(NSNumber *object) {
+		return [object stringValue];
+	} rightKey:^id(NSString *object) {
+		return object;
+	} combine:^id(NSNumber *left, NSString *right) {
+		return [NSString stringWithFormat:@"%@=%@", left, right];
+	}];
+	NSArray<NSString *> *expected = @[@"1=1", @"4=4", @"4=4", @"9=9"];
+
+	XCTAssertEqualObjects(joined, expected, @"The two arrays should be the same.");
+}
+
+- (void)testJoin_order
+{
+	NSArray<NSString *> *larger = @[@"c", @"a", @"b", @"a", @"d", @"c", @"e"];
+	NSArray<NSString *> *smaller = @[@"b", @"a", @"c"];
+	id (^key)(NSString *) = ^id(NSString *object) { return object; };
+
+	/// The receiver is the smaller side so the table is built over it, and the results must still follow its order.
+	NSArray<NSString *> *smallerFirst = [smaller joinWith:larger leftKey:key rightKey:key combine:^id(NSString *left, NSString *right) {
+		return left;
+	}];
+	NSArray<NSString *> *expectedSmallerFirst = @[@"b", @"a", @"a", @"c", @"c"];
+
+	XCTAssertEqualObjects(smallerFirst, expectedSmallerFirst, @"The results should follow the order of the receiver.");
+
+	NSArray<NSString *> *largerFirst = [larger joinWith:smaller leftKey:key rightKey:key combine:^id(NSString *left, NSString *right) {
+		return left;
+	}];
+	NSArray<NSString *> *expectedLargerFirst = @[@"c", @"a", @"b", @"a", @"c"];
+
+	XCTAssertEqualObjects(largerFirst, expectedLargerFirst, @"The results should follow the order of the receiver.");
+
+	NSArray<NSString *> *concurrent = [smaller joinWith:larger leftKey:key rightKey:key options:CBHJoinOptionsConcurrent combine:^id(NSString *left, NSString *right) {
+		return left;
+	}];
+
+	XCTAssertEqualObjects(concurrent, expectedSmallerFirst, @"The results should follow the order of the receiver.");
+}
+
+- (void)testJoin_concurrent
+{
+	NSMutableArray<NSNumber *> *array = [NSMutableArray arrayWithCapacity:10000];
+	for (NSUInteger i = 0; i < 10000; ++i) { [array addObject:@(i)]; }
+
+	NSArray<NSNumber *> *other = @[@0, @3, @6];
+	id (^key)(NSNumber *) = ^id(NSNumber *object) { return @([object unsignedIntegerValue] % 9); };
+
+	NSArray<NSNumber *> *serial = [array joinWith:other leftKey:key rightKey:^id(NSNumber *object) {
+		return object;
+	} combine:^id(NSNumber *left, NSNumber *right) {
+		return left;
+	}];
+	NSArray<NSNumber *> *concurrent = [array joinWith:other leftKey:key rightKey:^id(NSNumber *object) {
+		return object;
+	} options:CBHJoinOptionsConcurrent combine:^id(NSNumber *left, NSNumber *right) {
+		return left;
+	}];
+
+	XCTAssertEqual([serial count], (NSUInteger)3334, @"The join should contain every third element.");
+	XCTAssertEqualObjects(serial, concurrent, @"The two arrays should be the same.");
+}
+
+- (void)testJoin_executor
+{
+	NSMutableArray<NSNumber *> *array = [NSMutableArray arrayWithCapacity:1000];
+	for (NSUInteger i = 0; i < 1000; ++i) { [array addObject:@(i)]; }
+
+	NSArray<NSNumber *> *other = @[@0, @3, @6];
+	id (^key)(NSNumber *) = ^id(NSNumber *object) { return @([object unsignedIntegerValue] % 9); };
+
+	NSArray<NSNumber *> *serial = [array semiJoinWith:other leftKey:key rightKey:key];
+	NSArray<NSNumber *> *concurrent = [array semiJoinWith:other leftKey:key rightKey:key executor:[CBHMapReduceExecutor dispatchExecutorWithWorkerCount:4]];
+
+	XCTAssertEqualObjects(concurrent, serial, @"The two arrays should be the same.");
+}
+
+- (void)testJoin_smallerLeft
+{
+	/// Plain objects do not conform to `NSCopying`, so they can only be keys if the table retains them rather than copying them.
+	NSObject *a = [[NSObject alloc] init];
+	NSObject *b = [[NSObject alloc] init];
+	NSObject *c = [[NSObject alloc] init];
+
+	NSArray *smaller = @[b, a, c];
+	NSArray *larger = @[a, a, b, [[NSObject alloc] init], [[NSObject alloc] init]];
+	id (^key)(id) = ^id(id object) { return object; };
+	id (^combine)(id, id) = ^id(id left, id right) { return ( right ) ? @"match" : @"none"; };
+	CBHMapReduceExecutor *executor = [CBHMapReduceExecutor dispatchExecutorWithWorkerCount:4];
+
+	NSArray *expectedOuter = @[@"match", @"match", @"match", @"none"];
+	XCTAssertEqualObjects([smaller leftOuterJoinWith:larger leftKey:key rightKey:key combine:combine], expectedOuter, @"The two arrays should be the same.");
+	XCTAssertEqualObjects([smaller leftOuterJoinWith:larger leftKey:key rightKey:key executor:executor combine:combine], expectedOuter, @"The two arrays should be the same.");
+
+	NSArray *expectedSemi = @[b, a];
+	XCTAssertEqualObjects([smaller semiJoinWith:larger leftKey:key rightKey:key], expectedSemi, @"The two arrays should be the same.");
+	XCTAssertEqualObjects([smaller semiJoinWith:larger leftKey:key rightKey:key executor:executor], expectedSemi, @"The two arrays should be the same.");
+
+	NSArray *expectedAnti = @[c];
+	XCTAssertEqualObjects([smaller antiJoinWith:larger leftKey:key rightKey:key], expectedAnti, @"The two arrays should be the same.");
+	XCTAssertEqualObjects([smaller antiJoinWith:larger leftKey:key rightKey:key executor:executor], expectedAnti, @"The two arrays should be the same.");
+}
+
+- (void)testLeftOuterJoin
+{
+	NSArray<NSNumber *> *array = @[@1, @2, @3, @4, @5];
+	NSArray<NSString *> *other = @[@"2", @"4", @"6"];
+	NSArray<NSString *> *joined = [array leftOuterJoinWith:other leftKey:^id(NSNumber *object) {
+		return [object stringValue];
+	} rightKey:^id(NSString *object) {
+		return object;
+	} combine:^id(NSNumber *left, NSString *right) {
+		return ( right ) ? right : @"-";
+	}];
+	NSArray<NSString *> *expected = @[@"-", @"2", @"-", @"4", @"-"];
+
+	XCTAssertEqualObjects(joined, expected, @"The two arrays should be the same.");
+}
+
+- (void)testSemiJoin
+{
+	NSArray<NSNumber *> *array = @[@1, @2, @3, @4, @5, @6, @7, @8, @9, @10];
+	NSArray<NSNumber *> *joined = [array semiJoinWith:@[@2, @4, @4, @11] leftKey:^id(NSNumber *object) {
+		return object;
+	} rightKey:^id(NSNumber *object) {
+		return object;
+	}];
+	NSArray<NSNumber *> *expected = @[@2, @4];
+
+	XCTAssertEqualObjects(joined, expected, @"The two arrays should be the same.");
+}
+
+- (void)testAntiJoin
+{
+	NSArray<NSNumber *> *array = @[@1, @2, @3, @4, @5, @6, @7, @8, @9, @10];
+	NSArray<NSNumber *> *joined = [array antiJoinWith:@[@2, @4, @6, @8, @10] leftKey:^id(NSNumber *object) {
+		return object;
+	} rightKey:^id(NSNumber *object) {
+		return object;
+	}];
+	NSArray<NSNumber *> *expected = @[@1, @3, @5, @7, @9];
+
+	XCTAssertEqualObjects(joined, expected, @"The two arrays should be the same.");
+}
+
+
 #pragma mark - To Other Collection
 
 - (void)testToSet
@@ -160,4 +575,93 @@
 	XCTAssertEqualObjects(mapping, expected, @"The two arrays should be the same.");
 }
 
+- (void)testFiltering_executor
+{
+	NSMutableArray<NSNumber *> *array = [NSMutableArray arrayWithCapacity:10000];
+	for (NSUInteger i = 0; i < 10000; ++i) { [array addObject:@(i)]; }
+
+	BOOL (^predicate)(NSNumber *) = ^BOOL(NSNumber *object) {
+		return ( [object unsignedIntegerValue] % 3 != 0 );
+	};
+
+	NSArray<NSNumber *> *expected = [array arrayByFiltering:predicate];
+	[array filter:predicate executor:[CBHMapReduceExecutor workStealingExecutorWithWorkerCount:4]];
+
+	XCTAssertEqualObjects(array, expected, @"The two arrays should be the same.");
+}
+
+- (void)testFilteredView
+{
+	NSMutableArray<NSNumber *> *array = [@[@1, @2, @3, @4, @5, @6, @7, @8, @9, @10] mutableCopy];
+	CBHArrayView<NSNumber *> *view = [array filteredViewUsingPredicate:^BOOL(NSNumber *object) {
+		return ( [object unsignedIntValue] % 2 == 0 );
+	}];
+	XCTAssertEqualObjects(view, (@[@2, @4, @6, @8, @10]), @"The two arrays should be the same.");
+
+	NSMutableArray<NSNumber *> *source = [view mutableSource];
+
+	[source insertObject:@12 atIndex:0];
+	XCTAssertEqualObjects(view, (@[@12, @2, @4, @6, @8, @10]), @"The two arrays should be the same.");
+
+	[source removeObjectsAtIndexes:[NSIndexSet indexSetWithIndexesInRange:NSMakeRange(2, 2)]];
+	XCTAssertEqualObjects(view, (@[@12, @4, @6, @8, @10]), @"The two arrays should be the same.");
+
+	[source replaceObjectAtIndex:1 withObject:@14];
+	[source replaceObjectAtIndex:2 withObject:@5];
+	XCTAssertEqualObjects(view, (@[@12, @14, @6, @8, @10]), @"The two arrays should be the same.");
+
+	XCTAssertEqualObjects(view, [array arrayByFiltering:^BOOL(NSNumber *object) {
+		return ( [object unsignedIntValue] % 2 == 0 );
+	}], @"The two arrays should be the same.");
+}
+
+- (void)testFilteredView_manyMutations
+{
+	NSMutableArray<NSNumber *> *array = [NSMutableArray arrayWithCapacity:1000];
+	for (NSUInteger i = 0; i < 1000; ++i) { [array addObject:@(i)]; }
+
+	BOOL (^predicate)(NSNumber *) = ^BOOL(NSNumber *object) {
+		return ( [object unsignedIntegerValue] % 3 != 0 );
+	};
+	CBHArrayView<NSNumber *> *view = [array filteredViewUsingPredicate:predicate];
+	NSMutableArray<NSNumber *> *source = [view mutableSource];
+
+	/// Clustered insertions fill and split the chunks the view tracks its source with, and removals empty some of them.
+	for (NSUInteger i = 0; i < 2000; ++i)
+	{
+		NSUInteger index = (i * 7919) % [source count];
+
+		if ( i % 3 == 2 ) { [source removeObjectAtIndex:index]; }
+		else if ( i % 5 == 4 ) { [source replaceObjectAtIndex:index withObject:@(i)]; }
+		else { [source insertObject:@(i) atIndex:( i % 2 == 0 ) ? 500 : index]; }
+	}
+
+	XCTAssertEqualObjects(view, [array arrayByFiltering:predicate], @"The two arrays should be the same.");
+}
+
+- (void)testMappedView
+{
+	NSMutableArray<NSNumber *> *array = [@[@1, @2, @3] mutableCopy];
+	CBHArrayView<NSNumber *> *view = [array mappedViewUsingTransform:^id(NSNumber *object) {
+		return @([object integerValue] * 10);
+	}];
+
+	NSMutableArray<NSNumber *> *source = [view mutableSource];
+
+	[source addObject:@4];
+	XCTAssertEqualObjects(view, (@[@10, @20, @30, @40]), @"The two arrays should be the same.");
+
+	[source removeObjectAtIndex:0];
+	XCTAssertEqualObjects(view, (@[@20, @30, @40]), @"The two arrays should be the same.");
+	XCTAssertEqualObjects(array, (@[@2, @3, @4]), @"The two arrays should be the same.");
+
+	[source setArray:@[@7]];
+	XCTAssertEqualObjects(view, (@[@70]), @"The two arrays should be the same.");
+
+	/// Mutating the array itself bypasses the view until it is reloaded.
+	[array addObject:@8];
+	[view reload];
+	XCTAssertEqualObjects(view, (@[@70, @80]), @"The two arrays should be the same.");
+}
+
 @end
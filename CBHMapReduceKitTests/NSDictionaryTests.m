@@ -63,6 +63,28 @@
 	XCTAssertEqualObjects(reduction, expected, @"The two numbers should be the same.");
 }
 
+- (void)testExecutor
+{
+	NSMutableDictionary<NSNumber *, NSNumber *> *dictionary = [NSMutableDictionary dictionaryWithCapacity:10000];
+	for (NSUInteger i = 0; i < 10000; ++i) { [dictionary setObject:@(i * 2) forKey:@(i)]; }
+
+	CBHMapReduceExecutor *executor = [CBHMapReduceExecutor workStealingExecutorWithWorkerCount:4];
+	id (^transform)(NSNumber *, NSNumber *) = ^id(NSNumber *key, NSNumber *object) {
+		if ( [key unsignedIntegerValue] % 2 == 0 ) { return nil; }
+		return @([object unsignedIntegerValue] + 1);
+	};
+	BOOL (^predicate)(NSNumber *, NSNumber *) = ^BOOL(NSNumber *key, NSNumber *object) {
+		return ( [key unsignedIntegerValue] % 3 == 0 );
+	};
+	NSNumber *(^combine)(NSNumber *, NSNumber *) = ^NSNumber *(NSNumber *lhs, NSNumber *rhs) {
+		return @([lhs unsignedIntegerValue] + [rhs unsignedIntegerValue]);
+	};
+
+	XCTAssertEqualObjects([dictionary dictionaryByMapping:transform executor:executor], [dictionary dictionaryByMapping:transform], @"The two dictionaries should be the same.");
+	XCTAssertEqualObjects([dictionary dictionaryByFiltering:predicate executor:executor], [dictionary dictionaryByFiltering:predicate], @"The two dictionaries should be the same.");
+	XCTAssertEqualObjects([dictionary initial:@0 associativeReduce:combine executor:executor], @99990000, @"The two numbers should be the same.");
+}
+
 
 #pragma mark - Cross Collection
 
@@ -179,4 +201,32 @@
 	XCTAssertEqualObjects(dictionary, expected, @"The two dictionaries should be the same.");
 }
 
+- (void)testFilteredView
+{
+	NSMutableDictionary<NSString *, NSNumber *> *dictionary = [@{@"a": @1, @"b": @2, @"c": @3} mutableCopy];
+	CBHDictionaryView<NSString *, NSNumber *> *view = [dictionary filteredViewUsingPredicate:^BOOL(NSString *key, NSNumber *object) {
+		return ( [object unsignedIntValue] % 2 != 0 );
+	}];
+	XCTAssertEqualObjects(view, (@{@"a": @1, @"c": @3}), @"The two dictionaries should be the same.");
+
+	NSMutableDictionary<NSString *, NSNumber *> *source = [view mutableSource];
+
+	[source setObject:@5 forKey:@"d"];
+	[source setObject:@4 forKey:@"a"];
+	[source removeObjectForKey:@"c"];
+	XCTAssertEqualObjects(view, (@{@"d": @5}), @"The two dictionaries should be the same.");
+	XCTAssertEqualObjects(dictionary, (@{@"a": @4, @"b": @2, @"d": @5}), @"The two dictionaries should be the same.");
+}
+
+- (void)testMappedView
+{
+	NSMutableDictionary<NSString *, NSNumber *> *dictionary = [@{@"a": @1, @"b": @2} mutableCopy];
+	CBHDictionaryView<NSString *, NSNumber *> *view = [dictionary mappedViewUsingTransform:^id(NSString *key, NSNumber *object) {
+		return @([object integerValue] * 10);
+	}];
+
+	[[view mutableSource] setObject:@3 forKey:@"b"];
+	XCTAssertEqualObjects(view, (@{@"a": @10, @"b": @30}), @"The two dictionaries should be the same.");
+}
+
 @end
@@ -20,6 +20,47 @@
 @import CBHMapReduceKit;
 
 
+/// An enumerator that only implements `nextObject`, counting from zero up to a limit.
+@interface CBHSequenceEnumerator : NSEnumerator
+{
+	NSUInteger _next;
+	NSUInteger _limit;
+}
+
+- (instancetype)initWithLimit:(NSUInteger)limit;
+
+/// The number of objects pulled so far.
+- (NSUInteger)pulledCount;
+
+@end
+
+
+@implementation CBHSequenceEnumerator
+
+- (instancetype)initWithLimit:(NSUInteger)limit
+{
+	if ( (self = [super init]) )
+	{
+		_limit = limit;
+	}
+
+	return self;
+}
+
+- (id)nextObject
+{
+	if ( _next >= _limit ) { return nil; }
+	return @(_next++);
+}
+
+- (NSUInteger)pulledCount
+{
+	return _next;
+}
+
+@end
+
+
 @interface NSEnumeratorTests : XCTestCase
 @end
 
@@ -67,6 +108,31 @@
 	XCTAssertEqualObjects(mapping, expected, @"The two sets should be the same.");
 }
 
+- (void)testArray_mapping_expectedCount
+{
+	NSArray<NSNumber *> *source = [[[CBHSequenceEnumerator alloc] initWithLimit:5000] allObjects];
+	NSArray<NSNumber *> *mapping = [[source objectEnumerator] arrayByMapping:^id(NSNumber *object) {
+		return @([object unsignedIntegerValue] * 2);
+	} expectedCount:[source count]];
+	NSArray<NSNumber *> *expected = [source arrayByMapping:^id(NSNumber *object) {
+		return @([object unsignedIntegerValue] * 2);
+	}];
+
+	XCTAssertEqualObjects(mapping, expected, @"The two arrays should be the same.");
+}
+
+- (void)testArray_mapping_nextObject
+{
+	CBHSequenceEnumerator *enumerator = [[CBHSequenceEnumerator alloc] initWithLimit:1000];
+	NSMutableArray<NSNumber *> *mapping = [enumerator mutableArrayByMapping:^id(NSNumber *object) {
+		return @([object unsignedIntegerValue] + 1);
+	} expectedCount:1000];
+
+	XCTAssertEqual([mapping count], (NSUInteger)1000, @"Every element should be mapped.");
+	XCTAssertEqualObjects([mapping firstObject], @1, @"The two numbers should be the same.");
+	XCTAssertEqualObjects([mapping lastObject], @1000, @"The two numbers should be the same.");
+}
+
 
 #pragma mark - Filtering
 
@@ -103,6 +169,30 @@
 	XCTAssertEqualObjects(mapping, expected, @"The two sets should be the same.");
 }
 
+- (void)testSet_filtering_expectedCount
+{
+	NSSet<NSNumber *> *source = [NSSet setWithArray:[[[CBHSequenceEnumerator alloc] initWithLimit:5000] allObjects]];
+	NSSet<NSNumber *> *filtering = [[source objectEnumerator] setByFiltering:^BOOL(NSNumber *object) {
+		return ( [object unsignedIntegerValue] % 3 == 0 );
+	} expectedCount:[source count] / 3];
+	NSSet<NSNumber *> *expected = [source setByFiltering:^BOOL(NSNumber *object) {
+		return ( [object unsignedIntegerValue] % 3 == 0 );
+	}];
+
+	XCTAssertEqualObjects(filtering, expected, @"The two sets should be the same.");
+}
+
+- (void)testOrderedSet_filtering_nextObject
+{
+	CBHSequenceEnumerator *enumerator = [[CBHSequenceEnumerator alloc] initWithLimit:1000];
+	NSOrderedSet<NSNumber *> *filtering = [enumerator orderedSetByFiltering:^BOOL(NSNumber *object) {
+		return ( [object unsignedIntegerValue] >= 990 );
+	} expectedCount:10];
+	NSOrderedSet<NSNumber *> *expected = [NSOrderedSet orderedSetWithArray:@[@990, @991, @992, @993, @994, @995, @996, @997, @998, @999]];
+
+	XCTAssertEqualObjects(filtering, expected, @"The two sets should be the same.");
+}
+
 
 #pragma mark - Reducing
 
@@ -117,4 +207,213 @@
 	XCTAssertEqualObjects(reduction, expected, @"The two numbers should be the same.");
 }
 
+- (void)testReduce_nextObject
+{
+	CBHSequenceEnumerator *enumerator = [[CBHSequenceEnumerator alloc] initWithLimit:1001];
+	NSNumber *reduction = [enumerator initial:@0 reduce:^NSNumber *(NSNumber *memo, NSNumber *object) {
+		return @([memo unsignedIntegerValue] + [object unsignedIntegerValue]);
+	}];
+	NSNumber *expected = @500500;
+
+	XCTAssertEqualObjects(reduction, expected, @"The two numbers should be the same.");
+}
+
+- (void)testReduce_nextObject_firstBatch
+{
+	CBHSequenceEnumerator *enumerator = [[CBHSequenceEnumerator alloc] initWithLimit:1000];
+	__block NSUInteger pulledBeforeFirst = 0;
+
+	[enumerator initial:nil reduce:^id(id memo, NSNumber *object) {
+		if ( [object unsignedIntegerValue] == 0 ) { pulledBeforeFirst = [enumerator pulledCount]; }
+		return object;
+	}];
+
+	XCTAssertLessThanOrEqual(pulledBeforeFirst, (NSUInteger)16, @"The first object should be handed on before a large batch is pulled.");
+	XCTAssertEqual([enumerator pulledCount], (NSUInteger)1000, @"Every object should be pulled.");
+}
+
+- (void)testExecutor
+{
+	NSArray<NSNumber *> *source = [[[CBHSequenceEnumerator alloc] initWithLimit:5000] allObjects];
+	CBHMapReduceExecutor *executor = [CBHMapReduceExecutor workStealingExecutorWithWorkerCount:4];
+	id (^transform)(NSNumber *) = ^id(NSNumber *object) { return @([object unsignedIntegerValue] * 3); };
+	BOOL (^predicate)(NSNumber *) = ^BOOL(NSNumber *object) { return ( [object unsignedIntegerValue] % 7 == 0 ); };
+	NSNumber *(^combine)(NSNumber *, NSNumber *) = ^NSNumber *(NSNumber *lhs, NSNumber *rhs) {
+		return @([lhs unsignedIntegerValue] + [rhs unsignedIntegerValue]);
+	};
+
+	XCTAssertEqualObjects([[source objectEnumerator] arrayByMapping:transform executor:executor], [source arrayByMapping:transform], @"The two arrays should be the same.");
+	XCTAssertEqualObjects([[source objectEnumerator] arrayByFiltering:predicate executor:executor], [source arrayByFiltering:predicate], @"The two arrays should be the same.");
+	XCTAssertEqualObjects([[[CBHSequenceEnumerator alloc] initWithLimit:1001] initial:@0 associativeReduce:combine executor:executor], @500500, @"The two numbers should be the same.");
+}
+
+- (void)testKeyedReduce
+{
+	NSEnumerator<NSNumber *> *enumerator = [@[@1, @2, @3, @4, @5, @6, @7, @8, @9, @10] objectEnumerator];
+	NSDictionary<NSNumber *, NSNumber *> *reductions = [enumerator dictionaryByReducingWithKey:^id<NSCopying>(NSNumber *object) {
+		return @([object unsignedIntValue] % 3);
+	} initial:@0 reduce:^NSNumber *(NSNumber *memo, NSNumber *object) {
+		return @([memo unsignedIntegerValue] + [object unsignedIntValue]);
+	}];
+	NSDictionary<NSNumber *, NSNumber *> *expected = @{@0: @18, @1: @22, @2: @15};
+
+	XCTAssertEqualObjects(reductions, expected, @"The two dictionaries should be the same.");
+}
+
+- (void)testKeyedReduce_spilling
+{
+	NSMutableArray<NSString *> *words = [NSMutableArray array];
+	for (NSUInteger i = 0; i < 5000; ++i) { [words addObject:[NSString stringWithFormat:@"word-%lu", (unsigned long)(i * 7919 % 500)]]; }
+
+	id<NSCopying> (^key)(NSString *) = ^id<NSCopying>(NSString *word) {
+		return [word substringFromIndex:[word length] - 2];
+	};
+	id (^reduce)(id, NSString *) = ^id(NSArray *memo, NSString *word) {
+		return [memo arrayByAddingObject:word];
+	};
+
+	NSDictionary *expected = [[words objectEnumerator] dictionaryByReducingWithKey:key initial:@[] reduce:reduce];
+
+	NSError *error = nil;
+	NSDictionary *serial = [[words objectEnumerator] dictionaryByReducingWithKey:key initial:@[] reduce:reduce memoryBudget:1024 executor:nil error:&error];
+	XCTAssertNil(error, @"Spilling should not fail.");
+	XCTAssertEqualObjects(serial, expected, @"The two dictionaries should be the same.");
+
+	NSDictionary *concurrent = [[words objectEnumerator] dictionaryByReducingWithKey:key initial:@[] reduce:reduce memoryBudget:0 executor:[CBHMapReduceExecutor dispatchExecutor] error:&error];
+	XCTAssertNil(error, @"Spilling should not fail.");
+	XCTAssertEqualObjects(concurrent, expected, @"The two dictionaries should be the same.");
+
+	NSDictionary *unspilled = [[words objectEnumerator] dictionaryByReducingWithKey:key initial:@[] reduce:reduce memoryBudget:NSUIntegerMax executor:nil error:&error];
+	XCTAssertEqualObjects(unspilled, expected, @"The two dictionaries should be the same.");
+}
+
+- (void)testKeyedReduce_spillingMutable
+{
+	NSMutableArray<NSString *> *words = [NSMutableArray array];
+	for (NSUInteger i = 0; i < 5000; ++i) { [words addObject:[NSString stringWithFormat:@"word-%lu", (unsigned long)(i * 7919 % 500)]]; }
+
+	id<NSCopying> (^key)(NSString *) = ^id<NSCopying>(NSString *word) {
+		return [word substringFromIndex:[word length] - 2];
+	};
+
+	NSHashTable *created = [[NSHashTable alloc] initWithOptions:NSPointerFunctionsStrongMemory | NSPointerFunctionsObjectPointerPersonality capacity:0];
+	id (^reduce)(id, NSString *) = ^id(NSMutableArray *memo, NSString *word) {
+		if ( !memo )
+		{
+			memo = [NSMutableArray array];
+			@synchronized (created) { [created addObject:memo]; }
+		}
+
+		[memo addObject:word];
+		return memo;
+	};
+
+	NSDictionary *expected = [[words objectEnumerator] dictionaryByReducingWithKey:key initial:nil reduce:reduce];
+
+	void (^check)(CBHMapReduceExecutor *) = ^(CBHMapReduceExecutor *executor) {
+		[created removeAllObjects];
+
+		NSError *error = nil;
+		NSDictionary *spilled = [[words objectEnumerator] dictionaryByReducingWithKey:key initial:nil reduce:reduce memoryBudget:16 * 1024 executor:executor error:&error];
+		XCTAssertNil(error, @"Spilling should not fail.");
+		XCTAssertEqualObjects(spilled, expected, @"The two dictionaries should be the same.");
+
+		/// Spilled accumulators are read back as new arrays, so finding one shows that growing them in place counted against the budget.
+		NSUInteger spilledCount = 0;
+		for (id value in [spilled objectEnumerator])
+		{
+			if ( ![created containsObject:value] ) { ++spilledCount; }
+		}
+
+		XCTAssertGreaterThan(spilledCount, (NSUInteger)0, @"Accumulators grown in place should be spilled.");
+		XCTAssertLessThan(spilledCount, [spilled count], @"Keys that fit in the budget should stay in memory.");
+	};
+
+	check(nil);
+	check([CBHMapReduceExecutor dispatchExecutor]);
+}
+
+- (void)testScan
+{
+	NSEnumerator<NSNumber *> *enumerator = [@[@1, @2, @3, @4, @5] objectEnumerator];
+	NSArray<NSNumber *> *scans = [enumerator initial:@0 exclusiveScan:^NSNumber *(NSNumber *memo, NSNumber *object) {
+		return @([memo unsignedIntegerValue] + [object unsignedIntValue]);
+	}];
+	NSArray<NSNumber *> *expected = @[@0, @1, @3, @6, @10];
+
+	XCTAssertEqualObjects(scans, expected, @"The two arrays should be the same.");
+}
+
+- (void)testChunks
+{
+	NSEnumerator<NSNumber *> *enumerator = [@[@1, @2, @3, @4, @5, @6, @7] objectEnumerator];
+	NSArray<NSArray<NSNumber *> *> *chunks = [[enumerator chunksOfSize:3] allObjects];
+	NSArray<NSArray<NSNumber *> *> *expected = @[@[@1, @2, @3], @[@4, @5, @6], @[@7]];
+
+	XCTAssertEqualObjects(chunks, expected, @"The two arrays should be the same.");
+}
+
+- (void)testWindows
+{
+	NSEnumerator<NSNumber *> *enumerator = [@[@1, @2, @3, @4, @5, @6, @7] objectEnumerator];
+	NSMutableArray<NSArray<NSNumber *> *> *windows = [NSMutableArray array];
+
+	for (NSArray<NSNumber *> *window in [enumerator windowsOfSize:3 step:2])
+	{
+		[windows addObject:window];
+	}
+
+	NSArray<NSArray<NSNumber *> *> *expected = @[@[@1, @2, @3], @[@3, @4, @5], @[@5, @6, @7]];
+
+	XCTAssertEqualObjects(windows, expected, @"The two arrays should be the same.");
+
+	NSArray<NSArray<NSNumber *> *> *sparse = [[[@[@1, @2, @3, @4, @5, @6, @7] objectEnumerator] windowsOfSize:2 step:3] allObjects];
+	XCTAssertEqualObjects(sparse, (@[@[@1, @2], @[@4, @5]]), @"The two arrays should be the same.");
+}
+
+- (void)testWindowedReduce
+{
+	NSEnumerator<NSNumber *> *enumerator = [@[@1, @2, @3, @4, @5, @6] objectEnumerator];
+	NSArray<NSNumber *> *sums = [enumerator windowedReduceOfSize:3 initial:@0 add:^NSNumber *(NSNumber *memo, NSNumber *object) {
+		return @([memo integerValue] + [object integerValue]);
+	} remove:^NSNumber *(NSNumber *memo, NSNumber *object) {
+		return @([memo integerValue] - [object integerValue]);
+	}];
+	NSArray<NSNumber *> *expected = @[@6, @9, @12, @15];
+
+	XCTAssertEqualObjects(sums, expected, @"The two arrays should be the same.");
+}
+
+#pragma mark - Joining
+
+- (void)testArray_join
+{
+	NSEnumerator<NSNumber *> *enumerator = [@[@1, @2, @3, @4, @5, @6, @7, @8, @9, @10] objectEnumerator];
+	NSArray<NSString *> *joined = [enumerator joinWith:@[@"1", @"4", @"9"] leftKey:^id(NSNumber *object) {
+		return [object stringValue];
+	} rightKey:^id(NSString *object) {
+		return object;
+	} combine:^id(NSNumber *left, NSString *right) {
+		return [NSString stringWithFormat:@"%@=%@", left, right];
+	}];
+	NSArray<NSString *> *expected = @[@"1=1", @"4=4", @"9=9"];
+
+	XCTAssertEqualObjects(joined, expected, @"The two arrays should be the same.");
+}
+
+- (void)testArray_leftOuterJoin
+{
+	NSEnumerator<NSNumber *> *enumerator = [@[@1, @2, @3] objectEnumerator];
+	NSArray<NSString *> *joined = [enumerator leftOuterJoinWith:@[@"2"] leftKey:^id(NSNumber *object) {
+		return [object stringValue];
+	} rightKey:^id(NSString *object) {
+		return object;
+	} combine:^id(NSNumber *left, NSString *right) {
+		return ( right ) ? right : @"-";
+	}];
+	NSArray<NSString *> *expected = @[@"-", @"2", @"-"];
+
+	XCTAssertEqualObjects(joined, expected, @"The two arrays should be the same.");
+}
+
 @end
@@ -52,6 +52,21 @@
 	XCTAssertEqualObjects(mapping, expected, @"The two sets should be the same.");
 }
 
+- (void)testFiltering_executor
+{
+	NSMutableOrderedSet<NSNumber *> *set = [NSMutableOrderedSet orderedSetWithCapacity:10000];
+	for (NSUInteger i = 0; i < 10000; ++i) { [set addObject:@(i)]; }
+
+	BOOL (^predicate)(NSNumber *) = ^BOOL(NSNumber *object) {
+		return ( [object unsignedIntegerValue] % 3 != 0 );
+	};
+
+	NSOrderedSet<NSNumber *> *expected = [set orderedSetByFiltering:predicate];
+
+	XCTAssertEqualObjects([set orderedSetByFiltering:predicate executor:[CBHMapReduceExecutor dispatchExecutor]], expected, @"The two ordered sets should be the same.");
+	XCTAssertEqualObjects([set mutableOrderedSetByFiltering:predicate executor:[CBHMapReduceExecutor workStealingExecutor]], expected, @"The two ordered sets should be the same.");
+}
+
 - (void)testReduce
 {
 	NSOrderedSet<NSNumber *> *set = [NSOrderedSet orderedSetWithArray:@[@1, @2, @3, @4, @5, @6, @7, @8, @9, @10]];
@@ -63,6 +78,26 @@
 	XCTAssertEqualObjects(reduction, expected, @"The two numbers should be the same.");
 }
 
+- (void)testScan
+{
+	NSOrderedSet<NSNumber *> *set = [NSOrderedSet orderedSetWithArray:@[@1, @2, @3, @4, @5]];
+	NSArray<NSNumber *> *scans = [set initial:@0 scan:^NSNumber *(NSNumber *memo, NSNumber *object) {
+		return @([memo unsignedIntegerValue] + [object unsignedIntValue]);
+	}];
+	NSArray<NSNumber *> *expected = @[@1, @3, @6, @10, @15];
+
+	XCTAssertEqualObjects(scans, expected, @"The two arrays should be the same.");
+}
+
+- (void)testChunks
+{
+	NSOrderedSet<NSNumber *> *set = [NSOrderedSet orderedSetWithArray:@[@1, @2, @3, @4, @5]];
+	NSArray<NSArray<NSNumber *> *> *chunks = [set chunksOfSize:2];
+	NSArray<NSArray<NSNumber *> *> *expected = @[@[@1, @2], @[@3, @4], @[@5]];
+
+	XCTAssertEqualObjects(chunks, expected, @"The two arrays should be the same.");
+}
+
 
 #pragma mark - Cross Collection
 
@@ -176,4 +211,40 @@
 	XCTAssertEqualObjects(mapping, expected, @"The two ordered sets should be the same.");
 }
 
+- (void)testFiltering_executor
+{
+	NSMutableOrderedSet<NSNumber *> *set = [NSMutableOrderedSet orderedSetWithCapacity:10000];
+	for (NSUInteger i = 0; i < 10000; ++i) { [set addObject:@(i)]; }
+
+	BOOL (^predicate)(NSNumber *) = ^BOOL(NSNumber *object) {
+		return ( [object unsignedIntegerValue] % 3 != 0 );
+	};
+
+	NSOrderedSet<NSNumber *> *expected = [set orderedSetByFiltering:predicate];
+	[set filter:predicate executor:[CBHMapReduceExecutor workStealingExecutorWithWorkerCount:4]];
+
+	XCTAssertEqualObjects(set, expected, @"The two ordered sets should be the same.");
+}
+
+- (void)testFilteredView
+{
+	NSMutableOrderedSet<NSNumber *> *set = [NSMutableOrderedSet orderedSetWithArray:@[@1, @2, @3, @4, @5, @6]];
+	CBHArrayView<NSNumber *> *view = [set filteredViewUsingPredicate:^BOOL(NSNumber *object) {
+		return ( [object unsignedIntValue] % 2 != 0 );
+	}];
+	XCTAssertEqualObjects(view, (@[@1, @3, @5]), @"The two arrays should be the same.");
+
+	NSMutableOrderedSet<NSNumber *> *source = [view mutableSource];
+
+	[source insertObject:@7 atIndex:1];
+	XCTAssertEqualObjects(view, (@[@1, @7, @3, @5]), @"The two arrays should be the same.");
+
+	[source insertObject:@5 atIndex:0];
+	XCTAssertEqualObjects(view, (@[@1, @7, @3, @5]), @"The two arrays should be the same.");
+
+	[source removeObject:@3];
+	XCTAssertEqualObjects(view, (@[@1, @7, @5]), @"The two arrays should be the same.");
+	XCTAssertEqualObjects(set, ([NSOrderedSet orderedSetWithArray:@[@1, @7, @2, @4, @5, @6]]), @"The two ordered sets should be the same.");
+}
+
 @end
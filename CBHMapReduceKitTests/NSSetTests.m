@@ -64,6 +64,23 @@
 	XCTAssertEqualObjects(reduction, expected, @"The two numbers should be the same.");
 }
 
+- (void)testExecutor
+{
+	NSMutableSet<NSNumber *> *set = [NSMutableSet setWithCapacity:10000];
+	for (NSUInteger i = 0; i < 10000; ++i) { [set addObject:@(i)]; }
+
+	CBHMapReduceExecutor *executor = [CBHMapReduceExecutor workStealingExecutorWithWorkerCount:4];
+	id (^transform)(NSNumber *) = ^id(NSNumber *object) { return @([object unsignedIntegerValue] / 2); };
+	BOOL (^predicate)(NSNumber *) = ^BOOL(NSNumber *object) { return ( [object unsignedIntegerValue] % 3 == 0 ); };
+	NSNumber *(^combine)(NSNumber *, NSNumber *) = ^NSNumber *(NSNumber *lhs, NSNumber *rhs) {
+		return @([lhs unsignedIntegerValue] + [rhs unsignedIntegerValue]);
+	};
+
+	XCTAssertEqualObjects([set setByMapping:transform executor:executor], [set setByMapping:transform], @"The two sets should be the same.");
+	XCTAssertEqualObjects([set setByFiltering:predicate executor:executor], [set setByFiltering:predicate], @"The two sets should be the same.");
+	XCTAssertEqualObjects([set initial:@0 associativeReduce:combine executor:executor], @49995000, @"The two numbers should be the same.");
+}
+
 
 #pragma mark - Cross Collection
 
@@ -102,6 +119,50 @@
 }
 
 
+#pragma mark - Joining
+
+- (void)testJoin
+{
+	NSSet<NSNumber *> *set = [NSSet setWithArray:@[@1, @2, @3, @4, @5, @6, @7, @8, @9, @10]];
+	NSArray<NSString *> *joined = [set joinWith:@[@"2", @"4", @"11"] leftKey:^id(NSNumber *object) {
+		return [object stringValue];
+	} rightKey:^id(NSString *object) {
+		return object;
+	} combine:^id(NSNumber *left, NSString *right) {
+		return right;
+	}];
+	NSSet<NSString *> *expected = [NSSet setWithArray:@[@"2", @"4"]];
+
+	XCTAssertEqualObjects([NSSet setWithArray:joined], expected, @"The two sets should be the same.");
+}
+
+- (void)testSemiJoin
+{
+	NSSet<NSNumber *> *set = [NSSet setWithArray:@[@1, @2, @3, @4, @5, @6, @7, @8, @9, @10]];
+	NSSet<NSNumber *> *joined = [set semiJoinWith:@[@2, @4, @11] leftKey:^id(NSNumber *object) {
+		return object;
+	} rightKey:^id(NSNumber *object) {
+		return object;
+	}];
+	NSSet<NSNumber *> *expected = [NSSet setWithArray:@[@2, @4]];
+
+	XCTAssertEqualObjects(joined, expected, @"The two sets should be the same.");
+}
+
+- (void)testAntiJoin
+{
+	NSSet<NSNumber *> *set = [NSSet setWithArray:@[@1, @2, @3, @4, @5]];
+	NSSet<NSNumber *> *joined = [set antiJoinWith:@[@2, @4] leftKey:^id(NSNumber *object) {
+		return object;
+	} rightKey:^id(NSNumber *object) {
+		return object;
+	} options:CBHJoinOptionsConcurrent];
+	NSSet<NSNumber *> *expected = [NSSet setWithArray:@[@1, @3, @5]];
+
+	XCTAssertEqualObjects(joined, expected, @"The two sets should be the same.");
+}
+
+
 #pragma mark - To Other Collection
 
 - (void)testToArray